@@ -33,11 +33,30 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <iomanip>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#define RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define RRLIB_RTTI_CONVERSION_FLOATING_POINT_CHARCONV
+#endif
+#endif
+#endif
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RRLIB_RTTI_CONVERSION_ZERO_COPY_DESERIALIZATION  // binary layout of arithmetic types equals their memory layout
+#endif
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti_conversion/tStaticCastOperation.h"
+#include "rrlib/rtti_conversion/tIntermediateObject.h"
+#include "rrlib/rtti_conversion/tScratchIntermediate.h"
+#include "rrlib/rtti_conversion/tWorkerPool.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -62,6 +81,11 @@ namespace conversion
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+/*! Number of elements from which the For Each operation converts elements in parallel if no 'Parallel Threshold' parameter is specified (0 disables this) */
+#ifndef RRLIB_RTTI_CONVERSION_FOR_EACH_PARALLEL_THRESHOLD
+#define RRLIB_RTTI_CONVERSION_FOR_EACH_PARALLEL_THRESHOLD 0
+#endif
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
@@ -147,70 +171,146 @@ public:
   {
     if ((source_type.GetTypeTraits() & trait_flags::cIS_STRING_SERIALIZABLE) && destination_type == tDataType<std::string>())
     {
+#ifdef RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
+      tConversionOption arithmetic_option = GetArithmeticConversionOption < int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t
+#ifdef RRLIB_RTTI_CONVERSION_FLOATING_POINT_CHARCONV
+                                            , float, double
+#endif
+                                            > (source_type, destination_type);
+      if (arithmetic_option.type != tConversionOptionType::NONE)
+      {
+        return arithmetic_option;
+      }
+#endif
       return tConversionOption(source_type, destination_type, false, &FirstConversionFunction, &FinalConversionFunction);
     }
     return tConversionOption();
   }
 
-  static void MainConversionFunction(const tTypedConstPointer& source_object, std::string& destination, const tCurrentConversionOperation& operation)
+  virtual tPathPlanningRole PathPlanningRole() const override
   {
-    rrlib::serialization::tStringOutputStream stream;
+    return tPathPlanningRole::ENCODING;
+  }
+
+  virtual tConversionOption SpecializeForParameter(const tConversionOption& option, const tTypedConstPointer& parameter, uint64_t& parameter_state) const override
+  {
+    unsigned int flags = parameter ? *parameter.Get<unsigned int>() : 0;
+
+    // Arithmetic fast path interprets flags itself - string stream path gets the decoded stream format flags
+    parameter_state = option.final_conversion_function == &FinalConversionFunction ? StreamFormatFlags(flags) : flags;
+    return option;
+  }
 
-    // init stream
-    /*auto precision = operation.GetParameterValue(0);
-    if (precision)
+  /*!
+   * \param flags Flags parameter of operation
+   * \return Format flags of string stream after applying the stream manipulators selected by the flags (zero if no flags are set)
+   */
+  static uint64_t StreamFormatFlags(unsigned int flags)
+  {
+    if (!flags)
     {
-      stream.GetWrappedStringStream() << std::setprecision(*precision.Get<int>());
-    }*/
-    auto flags = operation.GetParameterValue();
-    if (flags)
+      return 0;
+    }
+    std::stringstream stream;
+    if (flags & eTSF_BOOL_ALPHA)
     {
-      unsigned int f = *flags.Get<unsigned int>();
-      if (f)
-      {
-        if (f & eTSF_BOOL_ALPHA)
-        {
-          stream.GetWrappedStringStream() << std::boolalpha;
-        }
-        if (f & eTSF_SHOW_BASE)
-        {
-          stream.GetWrappedStringStream() << std::showbase;
-        }
-        if (f & eTSF_SHOW_POINT)
-        {
-          stream.GetWrappedStringStream() << std::showpoint;
-        }
-        if (f & eTSF_SHOW_POS)
-        {
-          stream.GetWrappedStringStream() << std::showpos;
-        }
-        if (f & eTSF_UPPER_CASE)
-        {
-          stream.GetWrappedStringStream() << std::uppercase;
-        }
-        if (f & eTSF_DEC)
-        {
-          stream.GetWrappedStringStream() << std::dec;
-        }
-        if (f & eTSF_HEX)
-        {
-          stream.GetWrappedStringStream() << std::hex;
-        }
-        if (f & eTSF_OCT)
-        {
-          stream.GetWrappedStringStream() << std::oct;
-        }
-        if (f & eTSF_FIXED)
-        {
-          stream.GetWrappedStringStream() << std::fixed;
-        }
-        if (f & eTSF_SCIENTIFIC)
-        {
-          stream.GetWrappedStringStream() << std::scientific;
-        }
-      }
+      stream << std::boolalpha;
     }
+    if (flags & eTSF_SHOW_BASE)
+    {
+      stream << std::showbase;
+    }
+    if (flags & eTSF_SHOW_POINT)
+    {
+      stream << std::showpoint;
+    }
+    if (flags & eTSF_SHOW_POS)
+    {
+      stream << std::showpos;
+    }
+    if (flags & eTSF_UPPER_CASE)
+    {
+      stream << std::uppercase;
+    }
+    if (flags & eTSF_DEC)
+    {
+      stream << std::dec;
+    }
+    if (flags & eTSF_HEX)
+    {
+      stream << std::hex;
+    }
+    if (flags & eTSF_OCT)
+    {
+      stream << std::oct;
+    }
+    if (flags & eTSF_FIXED)
+    {
+      stream << std::fixed;
+    }
+    if (flags & eTSF_SCIENTIFIC)
+    {
+      stream << std::scientific;
+    }
+    return static_cast<uint64_t>(stream.flags());
+  }
+
+#ifdef RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
 
+  /*!
+   * Fast path for arithmetic types: formats value with std::to_chars - without any string stream.
+   * The result is identical to the result of MainConversionFunction (with the same flags).
+   * bool and 8 bit types are not handled, as their string representation is not numeric.
+   */
+  template <typename T>
+  static void ArithmeticMainConversionFunction(const tTypedConstPointer& source_object, std::string& destination, const tCurrentConversionOperation& operation)
+  {
+    unsigned int flags = static_cast<unsigned int>(operation.GetParameterState());
+    char buffer[cTO_CHARS_BUFFER_SIZE];
+    char* end = ToChars(*source_object.Get<T>(), flags, buffer, buffer + cTO_CHARS_BUFFER_SIZE);
+    if (end)
+    {
+      destination.assign(buffer, end);  // reuses capacity of destination
+    }
+    else
+    {
+      Serialize(source_object, destination, StreamFormatFlags(flags));
+    }
+  }
+
+  template <typename T>
+  static void ArithmeticFirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  {
+    tScratchIntermediate<std::string> intermediate;
+    ArithmeticMainConversionFunction<T>(source_object, intermediate.Get(), operation);
+    operation.Continue(tTypedConstPointer(&intermediate.Get()), destination_object);
+  }
+
+  template <typename T>
+  static void ArithmeticFinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  {
+    ArithmeticMainConversionFunction<T>(source_object, *destination_object.Get<std::string>(), operation);
+  }
+
+#endif
+
+  static void MainConversionFunction(const tTypedConstPointer& source_object, std::string& destination, const tCurrentConversionOperation& operation)
+  {
+    Serialize(source_object, destination, operation.GetParameterState());
+  }
+
+  /*!
+   * Serializes object to string
+   *
+   * \param stream_format_flags Format flags for string stream as returned by StreamFormatFlags() (zero to keep defaults)
+   */
+  static void Serialize(const tTypedConstPointer& source_object, std::string& destination, uint64_t stream_format_flags)
+  {
+    rrlib::serialization::tStringOutputStream stream;
+    if (stream_format_flags)
+    {
+      stream.GetWrappedStringStream().flags(static_cast<std::ios_base::fmtflags>(stream_format_flags));
+    }
     source_object.Serialize(stream);
     destination = stream.ToString();
   }
@@ -226,6 +326,100 @@ public:
   {
     MainConversionFunction(source_object, *destination_object.Get<std::string>(), operation);
   }
+
+#ifdef RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
+private:
+
+  /*! Size of buffer for std::to_chars (sufficient for any double in fixed notation) */
+  enum { cTO_CHARS_BUFFER_SIZE = 512 };
+
+  template <typename ... TArithmetic>
+  static tConversionOption GetArithmeticConversionOption(const tType& source_type, const tType& destination_type)
+  {
+    tConversionOption result;
+    int dummy[] = { (source_type == tDataType<TArithmetic>() ? (result = tConversionOption(source_type, destination_type, false, &ArithmeticFirstConversionFunction<TArithmetic>, &ArithmeticFinalConversionFunction<TArithmetic>), 0) : 0)... };
+    (void)dummy;
+    return result;
+  }
+
+  static void ToUpperCase(char* begin, char* end)
+  {
+    for (char* c = begin; c < end; c++)
+    {
+      *c = static_cast<char>(std::toupper(static_cast<unsigned char>(*c)));
+    }
+  }
+
+  /*!
+   * Formats integer like std::ostream with the specified flags
+   *
+   * \return End of formatted value in buffer (nullptr if value must be formatted with stream)
+   */
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, char*>::type ToChars(T value, unsigned int flags, char* buffer, char* buffer_end)
+  {
+    char* position = buffer;
+    int base = (flags & eTSF_OCT) ? 8 : ((flags & eTSF_HEX) ? 16 : 10);  // last manipulator wins in MainConversionFunction
+    if (base == 10)
+    {
+      if ((flags & eTSF_SHOW_POS) && std::is_signed<T>::value && value >= 0)
+      {
+        *(position++) = '+';
+      }
+      return std::to_chars(position, buffer_end, value).ptr;
+    }
+
+    // Streams print negative values in octal and hexadecimal notation as unsigned
+    typename std::make_unsigned<T>::type unsigned_value = static_cast<typename std::make_unsigned<T>::type>(value);
+    if ((flags & eTSF_SHOW_BASE) && unsigned_value)
+    {
+      *(position++) = '0';
+      if (base == 16)
+      {
+        *(position++) = 'x';
+      }
+    }
+    char* end = std::to_chars(position, buffer_end, unsigned_value, base).ptr;
+    if (flags & eTSF_UPPER_CASE)
+    {
+      ToUpperCase(buffer, end);
+    }
+    return end;
+  }
+
+#ifdef RRLIB_RTTI_CONVERSION_FLOATING_POINT_CHARCONV
+  /*!
+   * Formats floating point value like std::ostream with the specified flags (and default precision)
+   *
+   * \return End of formatted value in buffer (nullptr if value must be formatted with stream)
+   */
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, char*>::type ToChars(T value, unsigned int flags, char* buffer, char* buffer_end)
+  {
+    if (flags & eTSF_SHOW_POINT)
+    {
+      return nullptr;  // not supported by std::to_chars
+    }
+    std::chars_format format = (flags & eTSF_SCIENTIFIC) ? std::chars_format::scientific : ((flags & eTSF_FIXED) ? std::chars_format::fixed : std::chars_format::general);  // last manipulator wins in MainConversionFunction
+    char* position = buffer;
+    if ((flags & eTSF_SHOW_POS) && (!std::signbit(value)))
+    {
+      *(position++) = '+';
+    }
+    std::to_chars_result result = std::to_chars(position, buffer_end, value, format, 6);
+    if (result.ec != std::errc())
+    {
+      return nullptr;
+    }
+    if ((flags & eTSF_UPPER_CASE) && format != std::chars_format::fixed)  // streams print "inf" and "nan" in lower case with fixed notation
+    {
+      ToUpperCase(buffer, result.ptr);
+    }
+    return result.ptr;
+  }
+#endif
+
+#endif
 };
 
 class tStringDeserializationOperation : public tRegisteredConversionOperation
@@ -238,26 +432,152 @@ public:
   {
     if ((destination_type.GetTypeTraits() & trait_flags::cIS_STRING_SERIALIZABLE) && source_type == tDataType<std::string>())
     {
+      tConversionOption arithmetic_option = GetArithmeticConversionOption < bool
+#ifdef RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
+                                            , int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t
+#endif
+#ifdef RRLIB_RTTI_CONVERSION_FLOATING_POINT_CHARCONV
+                                            , float, double
+#endif
+                                            > (source_type, destination_type);
+      if (arithmetic_option.type != tConversionOptionType::NONE)
+      {
+        return arithmetic_option;
+      }
       return tConversionOption(source_type, destination_type, false, &FirstConversionFunction, &FinalConversionFunction);
     }
     return tConversionOption();
   }
 
+  virtual tPathPlanningRole PathPlanningRole() const override
+  {
+    return tPathPlanningRole::DECODING;
+  }
+
+  /*!
+   * Fast path for arithmetic types: parses value with std::from_chars - without any string stream.
+   * Strings that are not parsed completely (e.g. with leading '+' or trailing characters) are deserialized with the stream
+   * - so that results and error handling are identical to the generic path.
+   */
+  template <typename T>
+  static void ArithmeticFirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  {
+    T intermediate;
+    if (FromChars(*source_object.Get<std::string>(), intermediate))
+    {
+      operation.Continue(tTypedConstPointer(&intermediate), destination_object);
+    }
+    else
+    {
+      FirstConversionFunction(source_object, destination_object, operation);
+    }
+  }
+
+  template <typename T>
+  static void ArithmeticFinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  {
+    if (!FromChars(*source_object.Get<std::string>(), *destination_object.Get<T>()))
+    {
+      FinalConversionFunction(source_object, destination_object, operation);
+    }
+  }
+
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
-    tType inter_type = operation.compiled_operation.IntermediateType();
-    char intermediate_memory[inter_type.GetSize(true)];
-    auto intermediate_object = inter_type.EmplaceGenericObject(intermediate_memory);
     serialization::tStringInputStream stream(*source_object.Get<std::string>());
-    intermediate_object->Deserialize(stream);
+    tIntermediateObject intermediate_object(operation.compiled_operation.IntermediateType(), stream);  // reused by subsequent conversions
     operation.Continue(*intermediate_object, destination_object);
   }
 
-  static void FinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  static void FinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation&)
   {
     serialization::tStringInputStream stream(*source_object.Get<std::string>());
     destination_object.Deserialize(stream);
   }
+
+private:
+
+  template <typename ... TArithmetic>
+  static tConversionOption GetArithmeticConversionOption(const tType& source_type, const tType& destination_type)
+  {
+    tConversionOption result;
+    int dummy[] = { (destination_type == tDataType<TArithmetic>() ? (result = tConversionOption(source_type, destination_type, false, &ArithmeticFirstConversionFunction<TArithmetic>, &ArithmeticFinalConversionFunction<TArithmetic>), 0) : 0)... };
+    (void)dummy;
+    return result;
+  }
+
+  /*!
+   * Trims whitespace from string
+   *
+   * \param begin Begin of string (is moved behind leading whitespace)
+   * \param end End of string (is moved before trailing whitespace)
+   */
+  static void Trim(const char*& begin, const char*& end)
+  {
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin)))
+    {
+      begin++;
+    }
+    while (end > begin && std::isspace(static_cast<unsigned char>(*(end - 1))))
+    {
+      end--;
+    }
+  }
+
+  /*!
+   * Parses bool value ("true" or "false")
+   *
+   * \return Whether string was parsed successfully (value is only modified if so)
+   */
+  static bool FromChars(const std::string& string, bool& value)
+  {
+    const char* begin = string.c_str();
+    const char* end = begin + string.length();
+    Trim(begin, end);
+    size_t length = end - begin;
+    if (length == 4 && memcmp(begin, "true", 4) == 0)
+    {
+      value = true;
+      return true;
+    }
+    if (length == 5 && memcmp(begin, "false", 5) == 0)
+    {
+      value = false;
+      return true;
+    }
+    return false;
+  }
+
+#ifdef RRLIB_RTTI_CONVERSION_INTEGER_CHARCONV
+  /*!
+   * Parses numeric value with std::from_chars
+   *
+   * \return Whether complete string was parsed successfully (value is only modified if so)
+   */
+  template <typename T>
+  static bool FromChars(const std::string& string, T& value)
+  {
+    const char* begin = string.c_str();
+    const char* end = begin + string.length();
+    Trim(begin, end);
+
+    // only plain decimal numbers (std::from_chars also accepts e.g. "inf" and "nan" - which streams do not)
+    const char* first_digit = (begin < end && *begin == '-') ? begin + 1 : begin;
+    if (first_digit == end || !(std::isdigit(static_cast<unsigned char>(*first_digit)) || *first_digit == '.'))
+    {
+      return false;
+    }
+
+    T result;
+    std::from_chars_result parse_result = std::from_chars(begin, end, result);
+    if (parse_result.ec != std::errc() || parse_result.ptr != end)
+    {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+#endif
 };
 
 class tBinarySerializationOperation : public tRegisteredConversionOperation
@@ -275,20 +595,60 @@ public:
     return tConversionOption();
   }
 
+  virtual tPathPlanningRole PathPlanningRole() const override
+  {
+    return tPathPlanningRole::ENCODING;
+  }
+
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
-    serialization::tStackMemoryBuffer<serialization::cSTACK_BUFFERS_SIZE> buffer;
-    rrlib::serialization::tOutputStream stream(buffer);
+    serialization::tMemoryBuffer intermediate_buffer;
+    Serialize(source_object, intermediate_buffer);
+    operation.Continue(tTypedConstPointer(&intermediate_buffer), destination_object);
+  }
+
+  static void FinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation&)
+  {
+    Serialize(source_object, *destination_object.Get<serialization::tMemoryBuffer>());
+  }
+
+  /*!
+   * Serializes object directly into memory buffer (reusing the buffer's storage).
+   * If serialized size can be estimated, capacity is reserved up front - so that large objects are not copied when the buffer grows.
+   */
+  static void Serialize(const tTypedConstPointer& source_object, serialization::tMemoryBuffer& destination)
+  {
+    serialization::tOutputStream stream(destination);
+    size_t estimated_size = EstimateSerializedSize(source_object);
+    if (estimated_size)
+    {
+      stream.EnsureAdditionalCapacity(estimated_size);
+    }
     source_object.Serialize(stream);
     stream.Close();
-    operation.Continue(tTypedConstPointer(&static_cast<serialization::tMemoryBuffer&>(buffer)), destination_object);
   }
 
-  static void FinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  /*!
+   * \return Estimated size of binary serialized object (0 if no estimate is available)
+   */
+  static size_t EstimateSerializedSize(const tTypedConstPointer& source_object)
   {
-    serialization::tOutputStream stream(*destination_object.Get<serialization::tMemoryBuffer>());
-    destination_object.Serialize(stream);
+    const tType& type = source_object.GetType();
+    if (type.GetTypeTraits() & trait_flags::cSUPPORTS_BITWISE_COPY)
+    {
+      return type.GetSize();
+    }
+    if (type.IsListType() && (type.GetElementType().GetTypeTraits() & trait_flags::cSUPPORTS_BITWISE_COPY))
+    {
+      return cLIST_SIZE_PREFIX_ESTIMATE + source_object.GetVectorSize() * type.GetElementType().GetSize();
+    }
+    return 0;
   }
+
+private:
+
+  /*! Bytes reserved for list size information when estimating serialized size of lists */
+  enum { cLIST_SIZE_PREFIX_ESTIMATE = 8 };
 };
 
 class tBinaryDeserializationOperation : public tRegisteredConversionOperation
@@ -301,18 +661,89 @@ public:
   {
     if ((destination_type.GetTypeTraits() & trait_flags::cIS_BINARY_SERIALIZABLE) && source_type == tDataType<serialization::tMemoryBuffer>())
     {
+#ifdef RRLIB_RTTI_CONVERSION_ZERO_COPY_DESERIALIZATION
+      tConversionOption raw_option = GetRawConversionOption<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double>(source_type, destination_type);
+      if (raw_option.type != tConversionOptionType::NONE)
+      {
+        return raw_option;
+      }
+#endif
       return tConversionOption(source_type, destination_type, false, &FirstConversionFunction, &FinalConversionFunction);
     }
     return tConversionOption();
   }
 
+  virtual tPathPlanningRole PathPlanningRole() const override
+  {
+    return tPathPlanningRole::DECODING;
+  }
+
+#ifdef RRLIB_RTTI_CONVERSION_ZERO_COPY_DESERIALIZATION
+
+  /*!
+   * Zero-copy path for arithmetic types: their binary serialization equals their memory layout.
+   * Results reference the buffer's data directly - or are copied with a single memcpy.
+   * As alignment of buffer data is not known when selecting the option, data is only referenced for types that need no alignment.
+   */
+  template <typename ... TArithmetic>
+  static tConversionOption GetRawConversionOption(const tType& source_type, const tType& destination_type)
+  {
+    tConversionOption result;
+    int dummy[] = { (destination_type == tDataType<TArithmetic>() ? (result = GetRawConversionOption<TArithmetic>(source_type, destination_type, std::integral_constant<bool, alignof(TArithmetic) == 1>()), 0) : 0)... };
+    (void)dummy;
+    return result;
+  }
+
+  template <typename T>
+  static tConversionOption GetRawConversionOption(const tType& source_type, const tType& destination_type, std::true_type always_aligned)
+  {
+    return tConversionOption(source_type, destination_type, &RawFirstConversionFunction<T>, &RawGetDestinationReference<T>);
+  }
+
+  template <typename T>
+  static tConversionOption GetRawConversionOption(const tType& source_type, const tType& destination_type, std::false_type always_aligned)
+  {
+    return tConversionOption(source_type, destination_type, false, &RawFirstConversionFunction<T>, &RawFinalConversionFunction<T>);
+  }
+
+  template <typename T>
+  static const void* RawData(const tTypedConstPointer& source_object)
+  {
+    const serialization::tMemoryBuffer& buffer = *source_object.Get<serialization::tMemoryBuffer>();
+    if (buffer.GetSize() < sizeof(T))
+    {
+      throw std::invalid_argument("Memory buffer is too small for deserializing " + tDataType<T>().GetName());
+    }
+    return buffer.GetBufferPointer(0);
+  }
+
+  template <typename T>
+  static void RawFirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+  {
+    T value;
+    memcpy(&value, RawData<T>(source_object), sizeof(T));  // buffer data need not be aligned
+    operation.Continue(tTypedConstPointer(&value), destination_object);
+  }
+
+  template <typename T>
+  static void RawFinalConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation&)
+  {
+    memcpy(destination_object.GetRawDataPointer(), RawData<T>(source_object), sizeof(T));  // buffer data need not be aligned
+  }
+
+  template <typename T>
+  static tTypedConstPointer RawGetDestinationReference(const tTypedConstPointer& source_object, const tCurrentConversionOperation&)
+  {
+    static_assert(alignof(T) == 1, "Buffer data is only referenced for types that need no alignment");
+    return tTypedConstPointer(static_cast<const T*>(RawData<T>(source_object)));
+  }
+
+#endif
+
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
-    tType inter_type = operation.compiled_operation.IntermediateType();
-    char intermediate_memory[inter_type.GetSize(true)];
-    auto intermediate_object = inter_type.EmplaceGenericObject(intermediate_memory);
     serialization::tInputStream stream(*source_object.Get<serialization::tMemoryBuffer>());
-    intermediate_object->Deserialize(stream);
+    tIntermediateObject intermediate_object(operation.compiled_operation.IntermediateType(), stream);  // reused by subsequent conversions
     operation.Continue(*intermediate_object, destination_object);
   }
 
@@ -338,11 +769,15 @@ public:
     return tConversionOption();
   }
 
+  virtual tConversionOption SpecializeForParameter(const tConversionOption& option, const tTypedConstPointer& parameter, uint64_t& parameter_state) const override
+  {
+    parameter_state = parameter ? *parameter.Get<unsigned int>() : 0;
+    return option;
+  }
+
   static tTypedConstPointer GetDestinationReference(const tTypedConstPointer& source_object, const tCurrentConversionOperation& operation)
   {
-    auto index_parameter = operation.GetParameterValue();
-    unsigned int index = index_parameter ? (*index_parameter.Get<unsigned int>()) : 0;
-    auto result = source_object.GetVectorElement(index);
+    auto result = source_object.GetVectorElement(operation.GetParameterState());
     if (!result)
     {
       throw std::invalid_argument("Index out of bounds");
@@ -352,9 +787,7 @@ public:
 
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
-    auto index_parameter = operation.GetParameterValue();
-    unsigned int index = index_parameter ? (*index_parameter.Get<unsigned int>()) : 0;
-    auto intermediate = source_object.GetVectorElement(index);
+    auto intermediate = source_object.GetVectorElement(operation.GetParameterState());
     if (!intermediate)
     {
       throw std::invalid_argument("Index out of bounds");
@@ -366,7 +799,10 @@ public:
 class tForEach : public tRegisteredConversionOperation
 {
 public:
-  tForEach() : tRegisteredConversionOperation(util::tManagedConstCharPointer("For Each", false), tSupportedTypeFilter::GENERIC_VECTOR_CAST, tSupportedTypeFilter::GENERIC_VECTOR_CAST)
+  /*! Minimum number of elements converted by a thread at once */
+  enum { cMIN_PARALLEL_CHUNK_SIZE = 1024 };
+
+  tForEach() : tRegisteredConversionOperation(util::tManagedConstCharPointer("For Each", false), tSupportedTypeFilter::GENERIC_VECTOR_CAST, tSupportedTypeFilter::GENERIC_VECTOR_CAST, nullptr, tParameterDefinition("Parallel Threshold", tDataType<unsigned int>(), true))
   {}
 
   virtual tConversionOption GetConversionOption(const tType& source_type, const tType& destination_type) const override
@@ -378,6 +814,12 @@ public:
     return tConversionOption();
   }
 
+  virtual tConversionOption SpecializeForParameter(const tConversionOption& option, const tTypedConstPointer& parameter, uint64_t& parameter_state) const override
+  {
+    parameter_state = parameter ? *parameter.Get<unsigned int>() : RRLIB_RTTI_CONVERSION_FOR_EACH_PARALLEL_THRESHOLD;
+    return option;
+  }
+
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
     size_t size = source_object.GetVectorSize();
@@ -386,20 +828,31 @@ public:
     {
       tTypedConstPointer source_first = source_object.GetVectorElement(0);
       tTypedPointer destination_first = destination_object.GetVectorElement(0);
-      operation.Continue(source_first, destination_object);
+      size_t offset_source = source_first.GetType().GetSize();
+      size_t offset_destination = destination_first.GetType().GetSize();
       if (size > 1)
       {
-        tTypedConstPointer source_next = source_object.GetVectorElement(1);
-        tTypedPointer destination_next = destination_object.GetVectorElement(1);
-        operation.Continue(source_next, destination_next);
-        size_t offset_source = static_cast<const char*>(source_next.GetRawDataPointer()) - static_cast<const char*>(source_first.GetRawDataPointer());
-        size_t offset_destination = static_cast<const char*>(destination_next.GetRawDataPointer()) - static_cast<const char*>(destination_first.GetRawDataPointer());
-        for (size_t i = 2; i < size; i++)
+        offset_source = static_cast<const char*>(source_object.GetVectorElement(1).GetRawDataPointer()) - static_cast<const char*>(source_first.GetRawDataPointer());
+        offset_destination = static_cast<char*>(destination_object.GetVectorElement(1).GetRawDataPointer()) - static_cast<char*>(destination_first.GetRawDataPointer());
+      }
+
+      // Convert elements in parallel if there are at least 'Parallel Threshold' (0 means never)
+      size_t parallel_threshold = static_cast<size_t>(operation.GetParameterState());
+      if (parallel_threshold && size >= parallel_threshold && tWorkerPool::Instance().WorkerCount())
+      {
+        // Several chunks per thread so that threads finishing early can take over work
+        size_t chunk_size = std::max<size_t>(cMIN_PARALLEL_CHUNK_SIZE, size / (4 * (tWorkerPool::Instance().WorkerCount() + 1)));
+        const char* source_data = static_cast<const char*>(source_first.GetRawDataPointer());
+        char* destination_data = static_cast<char*>(destination_first.GetRawDataPointer());
+        tWorkerPool::Instance().ParallelFor(size, chunk_size, [&](size_t begin, size_t end)
         {
-          source_next = tTypedConstPointer(static_cast<const char*>(source_next.GetRawDataPointer()) + offset_source, source_next.GetType());
-          destination_next = tTypedPointer(static_cast<char*>(destination_next.GetRawDataPointer()) + offset_destination, destination_next.GetType());
-          operation.Continue(source_next, destination_next);
-        }
+          operation.ContinueBatch(tTypedConstPointer(source_data + begin * offset_source, source_first.GetType()), offset_source,
+                                  tTypedPointer(destination_data + begin * offset_destination, destination_first.GetType()), offset_destination, end - begin);
+        });
+      }
+      else
+      {
+        operation.ContinueBatch(source_first, offset_source, destination_first, offset_destination, size);
       }
     }
   }
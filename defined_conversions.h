@@ -80,7 +80,7 @@ extern const tRegisteredConversionOperation& cBINARY_SERIALIZATION_OPERATION;
 extern const tRegisteredConversionOperation& cBINARY_DESERIALIZATION_OPERATION; //!< Deserializes binary serializable type from serialization::tMemoryBuffer
 
 extern const tRegisteredConversionOperation& cGET_LIST_ELEMENT_OPERATION;       //!< Get Element with specified index (parameter) from list type (std::vector)
-extern const tRegisteredConversionOperation& cFOR_EACH_OPERATION;               //!< Special conversion operation for std::vectors that applies second conversion operation on all elements
+extern const tRegisteredConversionOperation& cFOR_EACH_OPERATION;               //!< Special conversion operation for std::vectors that applies second conversion operation on all elements (optional parameter: number of elements from which they are converted in parallel)
 
 //----------------------------------------------------------------------
 // End of namespace declaration
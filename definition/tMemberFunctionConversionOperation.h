@@ -124,7 +124,15 @@ private:
     *destination_object.Get<TDestination>() = ((*source_object.Get<TSource>()).*Tconversion_function)();
   }
 
-  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), Tdestination_reference_source_with_variable_offset, &FirstConversionFunction, &FinalConversionFunction);
+  static void BatchConversionFunction(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation& operation)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      *reinterpret_cast<TDestination*>(static_cast<char*>(destination) + i * destination_stride) = ((*reinterpret_cast<const TSource*>(static_cast<const char*>(source) + i * source_stride)).*Tconversion_function)();
+    }
+  }
+
+  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), Tdestination_reference_source_with_variable_offset, &FirstConversionFunction, &FinalConversionFunction, &BatchConversionFunction);
 
 };
 
@@ -120,7 +120,15 @@ private:
     *destination_object.Get<TDestination>() = (*Tconversion_function)(*source_object.Get<TSource>());
   }
 
-  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), Tdestination_reference_source_with_variable_offset, &FirstConversionFunction, &FinalConversionFunction);
+  static void BatchConversionFunction(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation& operation)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      *reinterpret_cast<TDestination*>(static_cast<char*>(destination) + i * destination_stride) = (*Tconversion_function)(*reinterpret_cast<const TSource*>(static_cast<const char*>(source) + i * source_stride));
+    }
+  }
+
+  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), Tdestination_reference_source_with_variable_offset, &FirstConversionFunction, &FinalConversionFunction, &BatchConversionFunction);
 
 };
 
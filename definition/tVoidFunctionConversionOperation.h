@@ -45,6 +45,7 @@
 //----------------------------------------------------------------------
 #include "rrlib/rtti_conversion/tRegisteredConversionOperation.h"
 #include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+#include "rrlib/rtti_conversion/tScratchIntermediate.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -107,8 +108,8 @@ private:
 
   static void FirstConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
   {
-    TDestination intermediate(serialization::DefaultInstantiation<TDestination>::Create());
-    tTypedPointer intermediate_pointer(&intermediate);
+    tScratchIntermediate<TDestination> intermediate;
+    tTypedPointer intermediate_pointer(&intermediate.Get());
     (*Tconversion_function)(*source_object.Get<TSource>(), *intermediate_pointer.Get<TDestination>());
     operation.Continue(intermediate_pointer, destination_object);
   }
@@ -118,7 +119,15 @@ private:
     (*Tconversion_function)(*source_object.Get<TSource>(), *destination_object.Get<TDestination>());
   }
 
-  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), false, &FirstConversionFunction, &FinalConversionFunction);
+  static void BatchConversionFunction(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation& operation)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      (*Tconversion_function)(*reinterpret_cast<const TSource*>(static_cast<const char*>(source) + i * source_stride), *reinterpret_cast<TDestination*>(static_cast<char*>(destination) + i * destination_stride));
+    }
+  }
+
+  static constexpr tConversionOption cCONVERSION_OPTION = tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), false, &FirstConversionFunction, &FinalConversionFunction, &BatchConversionFunction);
 
 };
 
@@ -0,0 +1,466 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/simd_casts.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/simd_casts.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define RRLIB_RTTI_CONVERSION_X86_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+tSimdInstructionSet DetectSimdInstructionSet()
+{
+#ifdef RRLIB_RTTI_CONVERSION_X86_SIMD_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return tSimdInstructionSet::AVX2;
+  }
+  if (__builtin_cpu_supports("sse2"))
+  {
+    return tSimdInstructionSet::SSE2;
+  }
+#endif
+  return tSimdInstructionSet::SCALAR;
+}
+
+#ifdef RRLIB_RTTI_CONVERSION_X86_SIMD_KERNELS
+
+/*!
+ * Vectorized kernels for a pair of types.
+ * Each kernel converts as many elements as possible with vector instructions - and the remaining ones with the scalar implementation.
+ */
+template <typename TSource, typename TDestination>
+struct tKernels;
+
+template <>
+struct tKernels<float, double>
+{
+  __attribute__((target("sse2"))) static void Sse2(const float* source, double* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 value = _mm_loadu_ps(source + i);
+      _mm_storeu_pd(destination + i, _mm_cvtps_pd(value));
+      _mm_storeu_pd(destination + i + 2, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const float* source, double* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_pd(destination + i, _mm256_cvtps_pd(_mm_loadu_ps(source + i)));
+      _mm256_storeu_pd(destination + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(source + i + 4)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<double, float>
+{
+  __attribute__((target("sse2"))) static void Sse2(const double* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 low = _mm_cvtpd_ps(_mm_loadu_pd(source + i));
+      __m128 high = _mm_cvtpd_ps(_mm_loadu_pd(source + i + 2));
+      _mm_storeu_ps(destination + i, _mm_movelh_ps(low, high));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const double* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm_storeu_ps(destination + i, _mm256_cvtpd_ps(_mm256_loadu_pd(source + i)));
+      _mm_storeu_ps(destination + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(source + i + 4)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<int32_t, float>
+{
+  __attribute__((target("sse2"))) static void Sse2(const int32_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      _mm_storeu_ps(destination + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const int32_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_ps(destination + i, _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<float, int32_t>
+{
+  __attribute__((target("sse2"))) static void Sse2(const float* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_cvttps_epi32(_mm_loadu_ps(source + i)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const float* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_cvttps_epi32(_mm256_loadu_ps(source + i)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<int32_t, double>
+{
+  __attribute__((target("sse2"))) static void Sse2(const int32_t* source, double* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      _mm_storeu_pd(destination + i, _mm_cvtepi32_pd(value));
+      _mm_storeu_pd(destination + i + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const int32_t* source, double* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_pd(destination + i, _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i))));
+      _mm256_storeu_pd(destination + i + 4, _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 4))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<double, int32_t>
+{
+  __attribute__((target("sse2"))) static void Sse2(const double* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128i low = _mm_cvttpd_epi32(_mm_loadu_pd(source + i));
+      __m128i high = _mm_cvttpd_epi32(_mm_loadu_pd(source + i + 2));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_unpacklo_epi64(low, high));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const double* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm256_cvttpd_epi32(_mm256_loadu_pd(source + i)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 4), _mm256_cvttpd_epi32(_mm256_loadu_pd(source + i + 4)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<int16_t, float>
+{
+  __attribute__((target("sse2"))) static void Sse2(const int16_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      _mm_storeu_ps(destination + i, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16)));
+      _mm_storeu_ps(destination + i + 4, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const int16_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_ps(destination + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<uint16_t, float>
+{
+  __attribute__((target("sse2"))) static void Sse2(const uint16_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      _mm_storeu_ps(destination + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(value, zero)));
+      _mm_storeu_ps(destination + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(value, zero)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const uint16_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_ps(destination + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<uint8_t, float>
+{
+  __attribute__((target("sse2"))) static void Sse2(const uint8_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      __m128i low = _mm_unpacklo_epi8(value, zero);
+      __m128i high = _mm_unpackhi_epi8(value, zero);
+      _mm_storeu_ps(destination + i, _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)));
+      _mm_storeu_ps(destination + i + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)));
+      _mm_storeu_ps(destination + i + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)));
+      _mm_storeu_ps(destination + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const uint8_t* source, float* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_ps(destination + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i)))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+template <>
+struct tKernels<int16_t, int32_t>
+{
+  __attribute__((target("sse2"))) static void Sse2(const int16_t* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 4), _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+
+  __attribute__((target("avx2"))) static void Avx2(const int16_t* source, int32_t* destination, size_t count)
+  {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i))));
+    }
+    StaticCastArrayScalar(source + i, destination + i, count - i);
+  }
+};
+
+#endif
+
+/*!
+ * Calls kernel for instruction set supported by CPU
+ */
+template <typename TSource, typename TDestination>
+inline void Dispatch(const TSource* source, TDestination* destination, size_t count)
+{
+#ifdef RRLIB_RTTI_CONVERSION_X86_SIMD_KERNELS
+  switch (GetSimdInstructionSet())
+  {
+  case tSimdInstructionSet::AVX2:
+    tKernels<TSource, TDestination>::Avx2(source, destination, count);
+    return;
+  case tSimdInstructionSet::SSE2:
+    tKernels<TSource, TDestination>::Sse2(source, destination, count);
+    return;
+  default:
+    break;
+  }
+#endif
+  StaticCastArrayScalar(source, destination, count);
+}
+
+}
+
+tSimdInstructionSet GetSimdInstructionSet()
+{
+  static const tSimdInstructionSet instruction_set = DetectSimdInstructionSet();
+  return instruction_set;
+}
+
+template <>
+void StaticCastArray<float, double>(const float* source, double* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<double, float>(const double* source, float* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<int32_t, float>(const int32_t* source, float* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<float, int32_t>(const float* source, int32_t* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<int32_t, double>(const int32_t* source, double* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<double, int32_t>(const double* source, int32_t* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<int16_t, float>(const int16_t* source, float* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<uint16_t, float>(const uint16_t* source, float* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<uint8_t, float>(const uint8_t* source, float* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+template <>
+void StaticCastArray<int16_t, int32_t>(const int16_t* source, int32_t* destination, size_t count)
+{
+  Dispatch(source, destination, count);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
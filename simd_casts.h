@@ -0,0 +1,140 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/simd_casts.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * Static casts of numeric arrays.
+ *
+ * For frequently used pairs of numeric types, explicitly vectorized SSE2 and AVX2 kernels are provided.
+ * The kernel is selected at runtime depending on the features of the CPU the program runs on.
+ * All other pairs of types (and CPUs without these instruction sets) use a scalar loop.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__simd_casts_h__
+#define __rrlib__rtti_conversion__simd_casts_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Instruction set used by vectorized cast kernels */
+enum class tSimdInstructionSet
+{
+  SCALAR,
+  SSE2,
+  AVX2
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return Instruction set that is used by vectorized cast kernels on this CPU
+ */
+tSimdInstructionSet GetSimdInstructionSet();
+
+/*!
+ * Converts array of numeric values using static_cast on each element (scalar implementation)
+ *
+ * \param source Source array
+ * \param destination Destination array (must not overlap with source array)
+ * \param count Number of elements to convert
+ */
+template <typename TSource, typename TDestination>
+inline void StaticCastArrayScalar(const TSource* source, TDestination* destination, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    destination[i] = static_cast<TDestination>(source[i]);
+  }
+}
+
+/*!
+ * Converts array of numeric values using static_cast on each element.
+ * Result is the same as with the scalar implementation (on x86 CPUs, conversions to integers truncate and conversions to floating point round to nearest).
+ * Specializations declared below use SSE2/AVX2 kernels if supported by the CPU.
+ *
+ * \param source Source array
+ * \param destination Destination array (must not overlap with source array)
+ * \param count Number of elements to convert
+ */
+template <typename TSource, typename TDestination>
+inline void StaticCastArray(const TSource* source, TDestination* destination, size_t count)
+{
+  StaticCastArrayScalar(source, destination, count);
+}
+
+template <>
+void StaticCastArray<float, double>(const float* source, double* destination, size_t count);
+template <>
+void StaticCastArray<double, float>(const double* source, float* destination, size_t count);
+template <>
+void StaticCastArray<int32_t, float>(const int32_t* source, float* destination, size_t count);
+template <>
+void StaticCastArray<float, int32_t>(const float* source, int32_t* destination, size_t count);
+template <>
+void StaticCastArray<int32_t, double>(const int32_t* source, double* destination, size_t count);
+template <>
+void StaticCastArray<double, int32_t>(const double* source, int32_t* destination, size_t count);
+template <>
+void StaticCastArray<int16_t, float>(const int16_t* source, float* destination, size_t count);
+template <>
+void StaticCastArray<uint16_t, float>(const uint16_t* source, float* destination, size_t count);
+template <>
+void StaticCastArray<uint8_t, float>(const uint8_t* source, float* destination, size_t count);
+template <>
+void StaticCastArray<int16_t, int32_t>(const int16_t* source, int32_t* destination, size_t count);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
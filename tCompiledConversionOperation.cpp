@@ -0,0 +1,121 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tCompiledConversionOperation.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Executes stages [stage, last_stage] of pipeline
+ */
+void ConvertStages(const tCompiledConversionOperation* stage, const tCompiledConversionOperation* last_stage, const tTypedConstPointer& source_object, const tTypedPointer& destination_object)
+{
+  if (stage == last_stage)
+  {
+    stage->Convert(source_object, destination_object);
+  }
+  else if (stage->Flags() & tCompiledConversionOperation::tFlag::cRESULT_REFERENCES_SOURCE_DIRECTLY)
+  {
+    ConvertStages(stage + 1, last_stage, stage->Convert(source_object), destination_object);  // no intermediate copy required
+  }
+  else
+  {
+    // Freshly constructed - as stages need not overwrite their destination completely
+    const tType& intermediate_type = stage->DestinationType();
+    char intermediate_memory[intermediate_type.GetSize(true)];
+    auto intermediate_object = intermediate_type.EmplaceGenericObject(intermediate_memory);
+    stage->Convert(source_object, *intermediate_object);
+    ConvertStages(stage + 1, last_stage, *intermediate_object, destination_object);
+  }
+}
+
+}
+
+void tCompiledConversionOperation::PipelineConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
+{
+  const std::vector<tCompiledConversionOperation>& stages = *operation.compiled_operation.pipeline;
+  ConvertStages(&stages.front(), &stages.back(), source_object, destination_object);
+}
+
+tTypedConstPointer tCompiledConversionOperation::PipelineReferenceFunction(const tTypedConstPointer& source_object, const tCurrentConversionOperation& operation)
+{
+  tTypedConstPointer result = source_object;
+  for (const tCompiledConversionOperation & stage : *operation.compiled_operation.pipeline)
+  {
+    result = stage.Convert(result);
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
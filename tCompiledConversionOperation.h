@@ -40,6 +40,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cstring>
+#include <memory>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -47,6 +50,7 @@
 #include "rrlib/rtti_conversion/defined_conversions.h"
 #include "rrlib/rtti_conversion/tConversionOperationSequence.h"
 #include "rrlib/rtti_conversion/tConversionOption.h"
+#include "rrlib/rtti_conversion/tConversionStatistics.h"
 #include "rrlib/rtti_conversion/tCurrentConversionOperation.h"
 
 //----------------------------------------------------------------------
@@ -94,7 +98,7 @@ public:
     cRESULT_REFERENCES_SOURCE_DIRECTLY = 1 << 31,    //!< Conversion can be performed with Convert(source_object).
   };
 
-  tCompiledConversionOperation() : tConversionOperationSequence(), conversion_function_first(nullptr), conversion_function_final(nullptr), fixed_offset_first(0), fixed_offset_final(0), flags(0)
+  tCompiledConversionOperation() : tConversionOperationSequence(), conversion_function_first(nullptr), conversion_function_final(nullptr), batch_conversion_function(nullptr), batch_conversion_function_final(nullptr), fixed_offset_first(0), fixed_offset_final(0), flags(0), parameter_state { 0, 0 }, pipeline()
   {}
 
   /*!
@@ -110,6 +114,9 @@ public:
   inline void Convert(const tTypedConstPointer& source_object, const tTypedPointer& destination_object) const
   {
     assert(flags & (tFlag::cRESULT_INDEPENDENT | tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY));
+#if RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+    tConversionStatistics::tMeasurement measurement(StatisticsOperation(0), destination_type.GetSize());
+#endif
     tTypedConstPointer intermediate_object(static_cast<const char*>(source_object.GetRawDataPointer()) + fixed_offset_first, type_after_first_fixed_offset); // in case we have a fixed offset and conversion function is a deep copy operation
     if (flags & tFlag::cDEEPCOPY_ONLY)
     {
@@ -136,6 +143,9 @@ public:
   inline tTypedConstPointer Convert(const tTypedConstPointer& source_object) const
   {
     assert(flags & tFlag::cRESULT_REFERENCES_SOURCE_DIRECTLY);
+#if RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+    tConversionStatistics::tMeasurement measurement(StatisticsOperation(0), 0);
+#endif
     tTypedConstPointer result(static_cast<const char*>(source_object.GetRawDataPointer()) + fixed_offset_first, type_after_first_fixed_offset);
     if (get_destination_reference_function_first != nullptr)
     {
@@ -143,6 +153,9 @@ public:
       result = (*get_destination_reference_function_first)(result, current_operation);
       if (get_destination_reference_function_final != nullptr)
       {
+#if RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+        tConversionStatistics::tMeasurement measurement(StatisticsOperation(1), 0);
+#endif
         tCurrentConversionOperation current_operation = { *this, 1 };
         result = (*get_destination_reference_function_final)(result, current_operation);
       }
@@ -151,6 +164,66 @@ public:
     return result;
   }
 
+  /*!
+   * Converts multiple objects (e.g. contiguous arrays) at once.
+   * Available for any conversion result type that Convert(source_object, destination_object) is available for.
+   * Dispatching is done once per batch. If the conversion operation provides a batch conversion function, it is called once.
+   * Otherwise, the conversion function is called for each object.
+   *
+   * \param source_base Pointer to first source object. Objects must have source type of this operation.
+   * \param source_stride Offset between two source objects in bytes (sizeof(TSource) for arrays)
+   * \param destination_base Pointer to first destination object. Objects must have destination type of this operation.
+   * \param destination_stride Offset between two destination objects in bytes (sizeof(TDestination) for arrays)
+   * \param count Number of objects to convert
+   *
+   * (note: For performance reasons, in general no type checks are performed.
+   *        The caller is responsible for ensuring that pointers point to objects of correct types.)
+   */
+  inline void ConvertBatch(const void* source_base, size_t source_stride, void* destination_base, size_t destination_stride, size_t count) const
+  {
+    assert(flags & (tFlag::cRESULT_INDEPENDENT | tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY));
+    const char* source = static_cast<const char*>(source_base) + fixed_offset_first;
+    char* destination = static_cast<char*>(destination_base);
+    if (flags & tFlag::cDEEPCOPY_ONLY)
+    {
+      if (destination_type.GetTypeTraits() & trait_flags::cSUPPORTS_BITWISE_COPY)
+      {
+        size_t size = destination_type.GetSize();
+        if (source_stride == size && destination_stride == size)
+        {
+          memcpy(destination, source, size * count);
+        }
+        else
+        {
+          for (size_t i = 0; i < count; i++, source += source_stride, destination += destination_stride)
+          {
+            memcpy(destination, source, size);
+          }
+        }
+      }
+      else
+      {
+        for (size_t i = 0; i < count; i++, source += source_stride, destination += destination_stride)
+        {
+          tTypedPointer(destination, destination_type).DeepCopyFrom(tTypedConstPointer(source, type_after_first_fixed_offset));
+        }
+      }
+    }
+    else if (batch_conversion_function)
+    {
+      tCurrentConversionOperation current_operation = { *this, 0 };
+      (*batch_conversion_function)(source, source_stride, destination, destination_stride, count, current_operation);
+    }
+    else
+    {
+      tCurrentConversionOperation current_operation = { *this, 0 };
+      for (size_t i = 0; i < count; i++, source += source_stride, destination += destination_stride)
+      {
+        (*conversion_function_first)(tTypedConstPointer(source, type_after_first_fixed_offset), tTypedPointer(destination, destination_type), current_operation);
+      }
+    }
+  }
+
   /*!
    * \return Flags for conversion operation
    */
@@ -159,6 +232,22 @@ public:
     return flags;
   }
 
+  /*!
+   * \return If conversion is a deep copy only (cDEEPCOPY_ONLY flag): offset of copied data in source object
+   */
+  unsigned int DeepCopyOffset() const
+  {
+    return fixed_offset_first;
+  }
+
+  /*!
+   * \return Final data type
+   */
+  const tType& DestinationType() const
+  {
+    return destination_type;
+  }
+
   /*!
    * \return Data type after first conversion function (possibly == destination_type)
    */
@@ -200,6 +289,12 @@ private:
     tConversionOption::tGetDestinationReferenceFunction get_destination_reference_function_final;
   };
 
+  /*! Function for converting multiple objects at once (only set if the whole operation is a single conversion function that provides one) */
+  tConversionOption::tBatchConversionFunction batch_conversion_function;
+
+  /*! Function for converting multiple objects at once with second conversion function (only set if second operation is a standard conversion function that provides one) */
+  tConversionOption::tBatchConversionFunction batch_conversion_function_final;
+
   /*!
    * Fixed offsets. In case a memcpy is possible, the second one is the size.
    */
@@ -207,6 +302,44 @@ private:
 
   /*! Flags for conversion operation */
   unsigned int flags;
+
+  /*!
+   * Operations and (converted) parameters of the two conversion functions - indexed like the functions.
+   * As conversion functions do not necessarily correspond to operations in sequence with the same index
+   * (e.g. if an implicit cast is performed first), they are stored separately from the sequence.
+   */
+  tSingleOperation function_operations[2];
+
+  /*! State words decoded from parameters by tRegisteredConversionOperation::SpecializeForParameter() (same indices as function_operations) */
+  uint64_t parameter_state[2];
+
+#if RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+  /*!
+   * \param operation_index Index of function in compiled operation
+   * \return Registered operation that statistics of function are recorded for
+   */
+  const tRegisteredConversionOperation* StatisticsOperation(unsigned int operation_index) const
+  {
+    return function_operations[(flags & tFlag::cFIRST_OPERATION_OPTIMIZED_AWAY) ? 1 : operation_index].operation;
+  }
+#endif
+
+  /*!
+   * If sequence has more than two operations: compiled operations with up to two steps each that are executed one after another.
+   * Conversion functions of this operation are then PipelineConversionFunction or PipelineReferenceFunction.
+   */
+  std::shared_ptr<const std::vector<tCompiledConversionOperation>> pipeline;
+
+  /*!
+   * Conversion function for pipelines whose result is independent or references source internally.
+   * Interior intermediate objects are only created for stages whose results do not reference their source directly.
+   */
+  static void PipelineConversionFunction(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation);
+
+  /*!
+   * Destination reference function for pipelines whose stages all reference their source directly
+   */
+  static tTypedConstPointer PipelineReferenceFunction(const tTypedConstPointer& source_object, const tCurrentConversionOperation& operation);
 };
 
 
@@ -214,6 +347,9 @@ private:
 inline void tCurrentConversionOperation::Continue(const tTypedConstPointer& intermediate_object, const tTypedPointer& destination_object) const
 {
   unsigned int next_operation_index = operation_index + 1;
+#if RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+  tConversionStatistics::tMeasurement measurement(compiled_operation.StatisticsOperation(next_operation_index), destination_object.GetType().GetSize());
+#endif
   if (compiled_operation.flags & next_operation_index)
   {
     // Do final DeepCopy
@@ -228,9 +364,65 @@ inline void tCurrentConversionOperation::Continue(const tTypedConstPointer& inte
   }
 }
 
+inline void tCurrentConversionOperation::ContinueBatch(const tTypedConstPointer& first_intermediate_object, size_t intermediate_stride, const tTypedPointer& first_destination_object, size_t destination_stride, size_t count) const
+{
+  unsigned int next_operation_index = operation_index + 1;
+  const char* intermediate = static_cast<const char*>(first_intermediate_object.GetRawDataPointer());
+  char* destination = static_cast<char*>(first_destination_object.GetRawDataPointer());
+  const tType& destination_type = first_destination_object.GetType();
+  if (compiled_operation.flags & next_operation_index)
+  {
+    // Do final DeepCopy
+    intermediate += compiled_operation.fixed_offset_final;
+    if (destination_type.GetTypeTraits() & trait_flags::cSUPPORTS_BITWISE_COPY)
+    {
+      size_t size = destination_type.GetSize();
+      if (intermediate_stride == size && destination_stride == size)
+      {
+        memcpy(destination, intermediate, size * count);
+      }
+      else
+      {
+        for (size_t i = 0; i < count; i++, intermediate += intermediate_stride, destination += destination_stride)
+        {
+          memcpy(destination, intermediate, size);
+        }
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < count; i++, intermediate += intermediate_stride, destination += destination_stride)
+      {
+        tTypedPointer(destination, destination_type).DeepCopyFrom(tTypedConstPointer(intermediate, destination_type));
+      }
+    }
+  }
+  else
+  {
+    tCurrentConversionOperation current_operation = { compiled_operation, next_operation_index };
+    if (compiled_operation.batch_conversion_function_final)
+    {
+      (*compiled_operation.batch_conversion_function_final)(intermediate, intermediate_stride, destination, destination_stride, count, current_operation);
+    }
+    else
+    {
+      const tType& intermediate_type = first_intermediate_object.GetType();
+      for (size_t i = 0; i < count; i++, intermediate += intermediate_stride, destination += destination_stride)
+      {
+        (*compiled_operation.conversion_function_final)(tTypedConstPointer(intermediate, intermediate_type), tTypedPointer(destination, destination_type), current_operation);
+      }
+    }
+  }
+}
+
 inline tTypedConstPointer tCurrentConversionOperation::GetParameterValue() const
 {
-  return compiled_operation.GetParameterValue((compiled_operation.flags & tCompiledConversionOperation::tFlag::cFIRST_OPERATION_OPTIMIZED_AWAY) ? 1 : operation_index);
+  return compiled_operation.function_operations[(compiled_operation.flags & tCompiledConversionOperation::tFlag::cFIRST_OPERATION_OPTIMIZED_AWAY) ? 1 : operation_index].GetParameter();
+}
+
+inline uint64_t tCurrentConversionOperation::GetParameterState() const
+{
+  return compiled_operation.parameter_state[(compiled_operation.flags & tCompiledConversionOperation::tFlag::cFIRST_OPERATION_OPTIMIZED_AWAY) ? 1 : operation_index];
 }
 
 //----------------------------------------------------------------------
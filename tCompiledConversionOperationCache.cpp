@@ -0,0 +1,176 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tCompiledConversionOperationCache.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tCompiledConversionOperationCache.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+inline void HashCombine(size_t& seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+}
+
+tCompiledConversionOperationCache::tCompiledConversionOperationCache() :
+  entries(),
+  revision(0),
+  mutex(),
+  hits(0),
+  misses(0)
+{}
+
+void tCompiledConversionOperationCache::Clear()
+{
+  tCompiledConversionOperationCache& cache = Instance();
+  rrlib::thread::tLock lock(cache.mutex);
+  cache.entries.clear();
+}
+
+std::shared_ptr<const tCompiledConversionOperation> tCompiledConversionOperationCache::Compile(const tConversionOperationSequence& sequence, bool allow_reference_to_source, const tType& source_type, const tType& destination_type)
+{
+  tCompiledConversionOperationCache& cache = Instance();
+  size_t hash = Hash(sequence, allow_reference_to_source, source_type, destination_type);
+  unsigned int current_revision = tRegisteredConversionOperation::GetRegisteredOperations().revision.load();
+  {
+    rrlib::thread::tLock lock(cache.mutex);
+    if (cache.revision != current_revision)
+    {
+      cache.entries.clear();
+      cache.revision = current_revision;
+    }
+    auto range = cache.entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      if (it->second.Matches(sequence, allow_reference_to_source, source_type, destination_type))
+      {
+        cache.hits++;
+        return it->second.compiled_operation;
+      }
+    }
+  }
+
+  // Compile without holding lock (may take a while; exceptions are passed to caller)
+  cache.misses++;
+  std::shared_ptr<const tCompiledConversionOperation> compiled_operation = std::make_shared<const tCompiledConversionOperation>(sequence.Compile(allow_reference_to_source, source_type, destination_type));
+
+  rrlib::thread::tLock lock(cache.mutex);
+  if (cache.revision != current_revision)
+  {
+    return compiled_operation; // registers changed meanwhile: do not add possibly outdated result to cache
+  }
+  auto range = cache.entries.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second.Matches(sequence, allow_reference_to_source, source_type, destination_type))
+    {
+      return it->second.compiled_operation; // another thread was faster
+    }
+  }
+  cache.entries.emplace(hash, tEntry { sequence, source_type, destination_type, allow_reference_to_source, compiled_operation });
+  return compiled_operation;
+}
+
+tCompiledConversionOperationCache::tStatistics tCompiledConversionOperationCache::GetStatistics()
+{
+  tCompiledConversionOperationCache& cache = Instance();
+  rrlib::thread::tLock lock(cache.mutex);
+  return tStatistics { cache.hits.load(), cache.misses.load(), cache.entries.size() };
+}
+
+size_t tCompiledConversionOperationCache::Hash(const tConversionOperationSequence& sequence, bool allow_reference_to_source, const tType& source_type, const tType& destination_type)
+{
+  size_t hash = allow_reference_to_source ? 1 : 0;
+  HashCombine(hash, source_type.GetHandle());
+  HashCombine(hash, destination_type.GetHandle());
+  HashCombine(hash, sequence.Size());
+  for (size_t i = 0; i < sequence.Size(); i++)
+  {
+    HashCombine(hash, reinterpret_cast<size_t>(sequence[i].first));  // operation names are not copied - so pointer is sufficient
+  }
+  for (size_t i = 1; i < sequence.Size(); i++)
+  {
+    HashCombine(hash, sequence.IntermediateType(i - 1).GetHandle());
+  }
+  return hash;
+}
+
+tCompiledConversionOperationCache& tCompiledConversionOperationCache::Instance()
+{
+  static tCompiledConversionOperationCache instance;
+  return instance;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
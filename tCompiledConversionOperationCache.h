@@ -0,0 +1,179 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tCompiledConversionOperationCache.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tCompiledConversionOperationCache
+ *
+ * \b tCompiledConversionOperationCache
+ *
+ * Process-wide cache of compiled conversion operations.
+ * Compiling a conversion operation sequence involves name lookups, searches for implicit casts
+ * and deserialization of parameters. When the same sequence is compiled for the same types
+ * repeatedly (e.g. whenever ports reconnect), the cache hands out a shared instance instead.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tCompiledConversionOperationCache_h__
+#define __rrlib__rtti_conversion__tCompiledConversionOperationCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tMutex.h"
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Cache of compiled conversion operations
+/*!
+ * Process-wide, thread-safe cache of compiled conversion operations.
+ * Compiled operations are keyed by (sequence, source type, destination type, allow_reference_to_source).
+ * They are immutable once compiled and can therefore be shared by all users.
+ *
+ * The cache is flushed automatically when further conversion operations or static casts are registered,
+ * as these may change the result of compiling a sequence (e.g. by providing another implicit cast).
+ */
+class tCompiledConversionOperationCache : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Cache statistics */
+  struct tStatistics
+  {
+    /*! Number of lookups that returned a cached compiled operation */
+    uint64_t hits;
+
+    /*! Number of lookups that required compiling the sequence */
+    uint64_t misses;
+
+    /*! Number of compiled operations currently in cache */
+    size_t size;
+  };
+
+  /*!
+   * Clears cache (statistics are not reset)
+   */
+  static void Clear();
+
+  /*!
+   * Obtains compiled conversion operation from cache - or compiles and adds it on cache miss.
+   * Parameters are the same as for tConversionOperationSequence::Compile().
+   *
+   * \param sequence Conversion operation sequence to compile
+   * \param allow_reference_to_source May the destination object reference the source?
+   * \param source_type Source Type (can be omitted if first operation has fixed source type)
+   * \param destination_type Destination Type (can be omitted if last operation has fixed destination type)
+   * \return Shared compiled conversion operation
+   * \throw Throws exception if conversion operation sequence erroneous, ambiguous, or cannot be used to convert specified types (failures are not cached)
+   */
+  static std::shared_ptr<const tCompiledConversionOperation> Compile(const tConversionOperationSequence& sequence, bool allow_reference_to_source, const tType& source_type = tType(), const tType& destination_type = tType());
+
+  /*!
+   * \return Cache statistics
+   */
+  static tStatistics GetStatistics();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Cache entry */
+  struct tEntry
+  {
+    /*! Key data */
+    tConversionOperationSequence sequence;
+    tType source_type, destination_type;
+    bool allow_reference_to_source;
+
+    /*! Compiled operation */
+    std::shared_ptr<const tCompiledConversionOperation> compiled_operation;
+
+    bool Matches(const tConversionOperationSequence& sequence, bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const
+    {
+      return this->allow_reference_to_source == allow_reference_to_source && this->source_type == source_type && this->destination_type == destination_type && this->sequence == sequence;
+    }
+  };
+
+  /*! Compiled operations in cache (key is hash of entry key data - so that lookups do not require copying the sequence) */
+  std::unordered_multimap<size_t, tEntry> entries;
+
+  /*! Revision of registered operations that cached entries were compiled with */
+  unsigned int revision;
+
+  /*! Mutex for cache access */
+  rrlib::thread::tMutex mutex;
+
+  /*! Statistics */
+  std::atomic<uint64_t> hits, misses;
+
+
+  tCompiledConversionOperationCache();
+
+  /*!
+   * \return Hash value for entry key data
+   */
+  static size_t Hash(const tConversionOperationSequence& sequence, bool allow_reference_to_source, const tType& source_type, const tType& destination_type);
+
+  /*!
+   * \return Single instance of cache
+   */
+  static tCompiledConversionOperationCache& Instance();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,331 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionCodeGenerator.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionCodeGenerator.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <sstream>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * \return String as C++ string literal
+ */
+std::string Quote(const std::string& string)
+{
+  std::string result = "\"";
+  for (char c : string)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result + "\"";
+}
+
+}
+
+tConversionCodeGenerator::tConversionCodeGenerator()
+{
+  AddType<bool>("bool");
+  AddType<int8_t>("int8_t");
+  AddType<uint8_t>("uint8_t");
+  AddType<int16_t>("int16_t");
+  AddType<uint16_t>("uint16_t");
+  AddType<int32_t>("int32_t");
+  AddType<uint32_t>("uint32_t");
+  AddType<int64_t>("int64_t");
+  AddType<uint64_t>("uint64_t");
+  AddType<float>("float");
+  AddType<double>("double");
+  AddType<std::string>("std::string");
+}
+
+void tConversionCodeGenerator::AddConversion(const tConversionOperationSequence& sequence, const tType& source_type, const tType& destination_type)
+{
+  if ((!source_type) || (!destination_type))
+  {
+    throw std::runtime_error("Source and destination type must be specified");
+  }
+
+  tConversion conversion;
+  conversion.source_type = source_type;
+  conversion.destination_type = destination_type;
+  const size_t size = sequence.Size();
+
+  // Infer types between operations
+  tType types[tConversionOperationSequence::cMAX_SIZE + 1];
+  types[0] = source_type;
+  types[size] = destination_type;
+  for (size_t i = 1; i < size; i++)
+  {
+    types[i] = sequence.IntermediateType(i - 1);
+    if ((!types[i]) && sequence[i - 1].second)
+    {
+      types[i] = sequence[i - 1].second->SupportedDestinationTypes().single_type;
+    }
+    if ((!types[i]) && sequence[i].second)
+    {
+      types[i] = sequence[i].second->SupportedSourceTypes().single_type;
+    }
+    if (!types[i])
+    {
+      throw std::runtime_error("Intermediate type must be specified");
+    }
+  }
+
+  // Obtain steps
+  const tRegisteredConversionOperation* static_cast_operation = &tStaticCastOperation::GetInstance();
+  for (size_t i = 0; i < size; i++)
+  {
+    if (sequence.GetParameterValue(i))
+    {
+      throw std::runtime_error("Code cannot be generated for operations with parameters");
+    }
+    const tRegisteredConversionOperation* operation = sequence[i].second ? sequence[i].second : &tRegisteredConversionOperation::Find(sequence[i].first, types[i], types[i + 1]);
+    tStep step = { operation->GetConversionOption(types[i], types[i + 1]), operation == static_cast_operation };
+    if (step.option.type == tConversionOptionType::NONE)
+    {
+      throw std::runtime_error("Type " + types[i].GetName() + " cannot be converted to " + types[i + 1].GetName() + " with operation " + operation->Name());
+    }
+    if (step.option.type != tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT && (!step.static_cast_option))
+    {
+      throw std::runtime_error(std::string("Code cannot be generated for operation ") + operation->Name());
+    }
+    conversion.operation_names.push_back(operation->Name());
+    if (i + 1 < size)
+    {
+      conversion.intermediate_types.push_back(sequence.IntermediateType(i));
+    }
+    conversion.steps.push_back(step);
+  }
+  if (size == 0 && source_type != destination_type)
+  {
+    auto implicit_conversion = tStaticCastOperation::GetImplicitConversionOptions(source_type, destination_type);
+    if (implicit_conversion.first.type == tConversionOptionType::NONE)
+    {
+      throw std::runtime_error("Type " + source_type.GetName() + " cannot be implicitly casted to " + destination_type.GetName());
+    }
+    conversion.steps.push_back(tStep { implicit_conversion.first, true });
+    if (implicit_conversion.second.type != tConversionOptionType::NONE)
+    {
+      conversion.steps.push_back(tStep { implicit_conversion.second, true });
+    }
+  }
+
+  // Check that all C++ type names are known
+  CppTypeName(source_type);
+  for (const tStep& step : conversion.steps)
+  {
+    CppTypeName(step.option.destination_type);
+    if (step.option.type != tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT && step.option.destination_type.IsListType() && step.option.source_type.IsListType())
+    {
+      CppTypeName(step.option.destination_type.GetElementType());
+    }
+  }
+  for (const tType& type : conversion.intermediate_types)
+  {
+    if (type)
+    {
+      CppTypeName(type);
+    }
+  }
+
+  conversions.push_back(conversion);
+}
+
+const std::string& tConversionCodeGenerator::CppTypeName(const tType& type) const
+{
+  auto it = cpp_type_names.find(type.GetHandle());
+  if (it == cpp_type_names.end())
+  {
+    throw std::runtime_error("C++ name of type " + type.GetName() + " is not known (add it with AddType())");
+  }
+  return it->second;
+}
+
+void tConversionCodeGenerator::Generate(std::ostream& stream) const
+{
+  stream << "// Generated by rrlib::rtti::conversion::tConversionCodeGenerator - do not edit" << std::endl << std::endl;
+  stream << "#include \"rrlib/rtti_conversion/tPrecompiledConversion.h\"" << std::endl;
+  for (const std::string& header : includes)
+  {
+    stream << "#include " << Quote(header) << std::endl;
+  }
+  stream << "#include <cstdint>" << std::endl << "#include <string>" << std::endl << "#include <vector>" << std::endl << std::endl;
+  stream << "namespace" << std::endl << "{" << std::endl << std::endl;
+  stream << "using namespace rrlib::rtti;" << std::endl << "using namespace rrlib::rtti::conversion;" << std::endl << std::endl;
+
+  for (size_t i = 0; i < conversions.size(); i++)
+  {
+    const tConversion& conversion = conversions[i];
+    const std::string& source = CppTypeName(conversion.source_type);
+    const std::string& destination = CppTypeName(conversion.destination_type);
+
+    // Function with all steps inlined
+    stream << "// " << conversion.source_type.GetName() << " -> " << conversion.destination_type.GetName() << std::endl;
+    stream << "inline void Convert" << i << "(const " << source << "& source, " << destination << "& destination)" << std::endl << "{" << std::endl;
+    if (conversion.steps.empty())
+    {
+      stream << "  destination = source;" << std::endl;
+    }
+    for (size_t j = 0; j < conversion.steps.size(); j++)
+    {
+      bool last_step = j + 1 == conversion.steps.size();
+      GenerateStep(stream, conversion.steps[j], j ? ("value" + std::to_string(j)) : std::string("source"), last_step ? std::string("destination") : ("value" + std::to_string(j + 1)), last_step);
+    }
+    stream << "}" << std::endl << std::endl;
+
+    // Conversion functions
+    stream << "void ConvertObject" << i << "(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation&)" << std::endl << "{" << std::endl;
+    stream << "  Convert" << i << "(*source_object.Get<" << source << ">(), *destination_object.Get<" << destination << ">());" << std::endl << "}" << std::endl << std::endl;
+    stream << "void ConvertBatch" << i << "(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation&)" << std::endl << "{" << std::endl;
+    stream << "  const char* source_pointer = static_cast<const char*>(source);" << std::endl;
+    stream << "  char* destination_pointer = static_cast<char*>(destination);" << std::endl;
+    stream << "  for (size_t i = 0; i < count; i++, source_pointer += source_stride, destination_pointer += destination_stride)" << std::endl << "  {" << std::endl;
+    stream << "    Convert" << i << "(*reinterpret_cast<const " << source << "*>(source_pointer), *reinterpret_cast<" << destination << "*>(destination_pointer));" << std::endl;
+    stream << "  }" << std::endl << "}" << std::endl << std::endl;
+
+    // Registration
+    stream << "const tPrecompiledConversion cPRECOMPILED_CONVERSION_" << i << "(tDataType<" << source << ">(), tDataType<" << destination << ">(), {";
+    for (size_t j = 0; j < conversion.operation_names.size(); j++)
+    {
+      stream << (j ? ", " : " ") << Quote(conversion.operation_names[j]) << (j + 1 == conversion.operation_names.size() ? " " : "");
+    }
+    stream << "}, {";
+    for (size_t j = 0; j < conversion.intermediate_types.size(); j++)
+    {
+      const tType& type = conversion.intermediate_types[j];
+      stream << (j ? ", " : " ") << (type ? ("tDataType<" + CppTypeName(type) + ">()") : std::string("tType()")) << (j + 1 == conversion.intermediate_types.size() ? " " : "");
+    }
+    stream << "}, &ConvertObject" << i << ", &ConvertBatch" << i << ");" << std::endl << std::endl;
+  }
+
+  stream << "}" << std::endl;
+}
+
+std::string tConversionCodeGenerator::Generate() const
+{
+  std::ostringstream stream;
+  Generate(stream);
+  return stream.str();
+}
+
+void tConversionCodeGenerator::GenerateStep(std::ostream& stream, const tStep& step, const std::string& source, const std::string& destination, bool last_step) const
+{
+  const tConversionOption& option = step.option;
+  const std::string& type = CppTypeName(option.destination_type);
+  std::string expression;
+  bool reference = true;
+  if (option.type == tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT)
+  {
+    expression = "*reinterpret_cast<const " + type + "*>(reinterpret_cast<const char*>(&" + source + ") + " + std::to_string(option.const_offset_reference_to_source_object) + ")";
+  }
+  else if (option.type == tConversionOptionType::VARIABLE_OFFSET_REFERENCE_TO_SOURCE_OBJECT)
+  {
+    expression = "static_cast<const " + type + "&>(" + source + ")";
+  }
+  else if (option.source_type.IsListType() && option.destination_type.IsListType())
+  {
+    // Static cast of std::vector: cast elements
+    if (!last_step)
+    {
+      stream << "  " << type << " " << destination << ";" << std::endl;
+    }
+    stream << "  " << destination << ".resize(" << source << ".size());" << std::endl;
+    stream << "  for (size_t i = 0; i < " << source << ".size(); i++)" << std::endl << "  {" << std::endl;
+    stream << "    " << destination << "[i] = static_cast<" << CppTypeName(option.destination_type.GetElementType()) << ">(" << source << "[i]);" << std::endl;
+    stream << "  }" << std::endl;
+    return;
+  }
+  else
+  {
+    assert(step.static_cast_option);
+    expression = "static_cast<" + type + ">(" + source + ")";
+    reference = false;
+  }
+
+  if (last_step)
+  {
+    stream << "  " << destination << " = " << expression << ";" << std::endl;
+  }
+  else
+  {
+    stream << "  const " << type << (reference ? "& " : " ") << destination << " = " << expression << ";" << std::endl;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,209 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionCodeGenerator.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionCodeGenerator
+ *
+ * \b tConversionCodeGenerator
+ *
+ * Generates C++ code with type-specialized conversion functions for conversion sequences.
+ * Generated functions are registered as tPrecompiledConversion - and therefore used by
+ * tConversionOperationSequence::Compile() when the generated translation unit is linked.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionCodeGenerator_h__
+#define __rrlib__rtti_conversion__tConversionCodeGenerator_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequence.h"
+#include "rrlib/rtti_conversion/tConversionOption.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Generator for precompiled conversions
+/*!
+ * Generates a C++ translation unit with type-specialized conversion functions for conversion sequences.
+ * All steps of a conversion are inlined into one function - without function pointers or flag checks.
+ * Generated functions are registered as tPrecompiledConversion - and therefore used by
+ * tConversionOperationSequence::Compile() when the generated translation unit is linked.
+ *
+ * Code can be generated for steps whose C++ equivalent is known: static casts (emitted as C++ static_cast - element-wise for std::vectors),
+ * const offsets and variable offsets of static casts (references to base classes).
+ * The C++ names of all types involved must be known (see AddType()).
+ */
+class tConversionCodeGenerator
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! C++ names of bool, fixed width integer types, float, double and std::string are known initially */
+  tConversionCodeGenerator();
+
+  /*!
+   * Adds conversion to generate code for
+   *
+   * \param sequence Conversion sequence (without parameters)
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \throw Throws std::runtime_error if no code can be generated for the conversion
+   */
+  void AddConversion(const tConversionOperationSequence& sequence, const tType& source_type, const tType& destination_type);
+
+  /*!
+   * Adds header to include in generated code (e.g. headers with declarations of types added via AddType())
+   *
+   * \param header Header (e.g. "rrlib/math/tVector.h")
+   */
+  void AddInclude(const std::string& header)
+  {
+    includes.push_back(header);
+  }
+
+  /*!
+   * Adds C++ name of type
+   *
+   * \param type Type
+   * \param cpp_type_name C++ name of type that is valid in generated code (e.g. "rrlib::math::tVec3d")
+   */
+  void AddType(const tType& type, const std::string& cpp_type_name)
+  {
+    cpp_type_names[type.GetHandle()] = cpp_type_name;
+  }
+  template <typename T>
+  void AddType(const std::string& cpp_type_name)
+  {
+    AddType(tDataType<T>(), cpp_type_name);
+  }
+
+  /*!
+   * Generates translation unit
+   *
+   * \param stream Stream to write generated code to
+   */
+  void Generate(std::ostream& stream) const;
+
+  /*!
+   * \return Generated translation unit
+   */
+  std::string Generate() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Single step of conversion */
+  struct tStep
+  {
+    /*! Conversion option */
+    tConversionOption option;
+
+    /*! Whether option is a static cast */
+    bool static_cast_option;
+  };
+
+  /*! Conversion to generate code for */
+  struct tConversion
+  {
+    /*! Source and destination type */
+    tType source_type, destination_type;
+
+    /*! Names of operations in sequence */
+    std::vector<std::string> operation_names;
+
+    /*! Intermediate types as specified in sequence */
+    std::vector<tType> intermediate_types;
+
+    /*! Steps of conversion */
+    std::vector<tStep> steps;
+  };
+
+  /*! Conversions to generate code for */
+  std::vector<tConversion> conversions;
+
+  /*! Headers to include */
+  std::vector<std::string> includes;
+
+  /*! C++ names of types (key is type handle) */
+  std::unordered_map<uint16_t, std::string> cpp_type_names;
+
+
+  /*!
+   * \return C++ name of type
+   * \throw Throws std::runtime_error if C++ name of type is not known
+   */
+  const std::string& CppTypeName(const tType& type) const;
+
+  /*!
+   * Generates code for single step
+   *
+   * \param stream Stream to write generated code to
+   * \param step Step
+   * \param source Name of variable with source of step
+   * \param destination Name of variable for result of step
+   * \param last_step Whether this is the last step (then 'destination' exists - otherwise it is declared)
+   */
+  void GenerateStep(std::ostream& stream, const tStep& step, const std::string& source, const std::string& destination, bool last_step) const;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,287 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionCostProfile.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionCostProfile.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <cstdlib>
+#include <fstream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/defined_conversions.h"
+#include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Measures cost of converting sample with operation
+ *
+ * \return Nanoseconds per conversion. Negative if operation cannot convert the sample.
+ */
+double Measure(const tRegisteredConversionOperation& operation, const tTypedConstPointer& sample, const tType& destination_type, std::chrono::nanoseconds measurement_duration)
+{
+  try
+  {
+    tCompiledConversionOperation compiled_operation = tConversionOperationSequence(operation).Compile(false, sample.GetType(), destination_type);
+    std::unique_ptr<tGenericObject> destination(destination_type.CreateGenericObject());
+    compiled_operation.Convert(sample, *destination);  // warm up (and check whether sample can be converted)
+
+    size_t iterations = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed;
+    do
+    {
+      for (size_t i = 0; i < 16; i++)
+      {
+        compiled_operation.Convert(sample, *destination);
+      }
+      iterations += 16;
+      elapsed = std::chrono::steady_clock::now() - start;
+    }
+    while (elapsed < measurement_duration);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+  }
+  catch (const std::exception& e)
+  {
+    return -1;
+  }
+}
+
+}
+
+tConversionCostProfile::tConversionCostProfile() :
+  revision(0)
+{}
+
+size_t tConversionCostProfile::Calibrate(const std::vector<tTypedConstPointer>& samples, std::chrono::nanoseconds measurement_duration)
+{
+  const tRegisteredConversionOperation::tRegisteredOperations& registered = tRegisteredConversionOperation::GetRegisteredOperations();
+  const tRegisteredConversionOperation& static_cast_operation = tStaticCastOperation::GetInstance();
+  size_t measured = 0;
+  auto measure = [&](const tRegisteredConversionOperation & operation, const tTypedConstPointer & sample, const tType & destination_type)
+  {
+    double nanoseconds = Measure(operation, sample, destination_type, measurement_duration);
+    if (nanoseconds >= 0)
+    {
+      SetCost(operation, sample.GetType(), destination_type, nanoseconds);
+      measured++;
+    }
+  };
+
+  for (const tTypedConstPointer & sample : samples)
+  {
+    const tType& source_type = sample.GetType();
+    for (const tConversionOptionStaticCast * static_cast_option : registered.static_cast_list.GetSnapshot())
+    {
+      if (static_cast_option->conversion_option.source_type == source_type)
+      {
+        measure(static_cast_operation, sample, static_cast_option->conversion_option.destination_type);
+      }
+    }
+
+    for (const tRegisteredConversionOperation * operation : registered.operation_list.GetSnapshot())
+    {
+      if (operation == &static_cast_operation || operation == &cFOR_EACH_OPERATION ||
+          (operation->SupportedSourceTypes().filter == tSupportedTypeFilter::SINGLE && operation->SupportedSourceTypes().single_type != source_type))
+      {
+        continue;
+      }
+      if (operation->SupportedDestinationTypes().filter == tSupportedTypeFilter::SINGLE)
+      {
+        if (operation->GetConversionOption(source_type, operation->SupportedDestinationTypes().single_type).type != tConversionOptionType::NONE)
+        {
+          measure(*operation, sample, operation->SupportedDestinationTypes().single_type);
+        }
+        continue;
+      }
+      for (const tTypedConstPointer & destination_sample : samples)
+      {
+        const tType& destination_type = destination_sample.GetType();
+        if (destination_type != source_type && operation->GetConversionOption(source_type, destination_type).type != tConversionOptionType::NONE)
+        {
+          measure(*operation, sample, destination_type);
+        }
+      }
+    }
+  }
+  return measured;
+}
+
+void tConversionCostProfile::Clear()
+{
+  tConversionCostProfile& profile = Instance();
+  rrlib::thread::tLock lock(profile.mutex);
+  profile.entries.clear();
+  profile.revision++;
+}
+
+double tConversionCostProfile::GetCost(const tRegisteredConversionOperation& operation, const tType& source_type, const tType& destination_type)
+{
+  tConversionCostProfile& profile = Instance();
+  rrlib::thread::tLock lock(profile.mutex);
+  auto it = profile.entries.find(Key(operation, source_type, destination_type));
+  return it != profile.entries.end() ? it->second.nanoseconds : -1;
+}
+
+std::vector<tConversionCostProfile::tEntry> tConversionCostProfile::GetEntries()
+{
+  tConversionCostProfile& profile = Instance();
+  rrlib::thread::tLock lock(profile.mutex);
+  std::vector<tEntry> result;
+  result.reserve(profile.entries.size());
+  for (auto & entry : profile.entries)
+  {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+tConversionCostProfile& tConversionCostProfile::Instance()
+{
+  static tConversionCostProfile instance;
+  return instance;
+}
+
+void tConversionCostProfile::Load(const std::string& file_name)
+{
+  std::ifstream file(file_name);
+  if (!file)
+  {
+    throw std::runtime_error("Could not open conversion cost profile " + file_name);
+  }
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::string columns[4];
+    size_t column = 0, start = 0;
+    for (; column < 4; column++)
+    {
+      size_t end = line.find('\t', start);
+      columns[column] = line.substr(start, end == std::string::npos ? std::string::npos : end - start);
+      if (end == std::string::npos)
+      {
+        break;
+      }
+      start = end + 1;
+    }
+    if (column != 3)
+    {
+      continue;  // empty or malformed line
+    }
+
+    char* number_end = nullptr;
+    double nanoseconds = strtod(columns[0].c_str(), &number_end);
+    tType source_type = tType::FindType(columns[2]);
+    tType destination_type = tType::FindType(columns[3]);
+    if (number_end == columns[0].c_str() || nanoseconds < 0 || (!source_type) || (!destination_type))
+    {
+      continue;
+    }
+    try
+    {
+      SetCost(tRegisteredConversionOperation::Find(columns[1], source_type, destination_type), source_type, destination_type, nanoseconds);
+    }
+    catch (const std::exception& e)
+    {
+      // operation is not available in this process
+    }
+  }
+}
+
+void tConversionCostProfile::Save(const std::string& file_name)
+{
+  tConversionCostProfile& profile = Instance();
+  std::ofstream file(file_name);
+  if (!file)
+  {
+    throw std::runtime_error("Could not open conversion cost profile " + file_name + " for writing");
+  }
+  rrlib::thread::tLock lock(profile.mutex);
+  for (auto & entry : profile.entries)
+  {
+    file << entry.second.nanoseconds << '\t' << entry.second.operation->Name() << '\t' << entry.second.source_type.GetName() << '\t' << entry.second.destination_type.GetName() << '\n';
+  }
+  if (!file)
+  {
+    throw std::runtime_error("Could not write conversion cost profile " + file_name);
+  }
+}
+
+void tConversionCostProfile::SetCost(const tRegisteredConversionOperation& operation, const tType& source_type, const tType& destination_type, double nanoseconds)
+{
+  tConversionCostProfile& profile = Instance();
+  rrlib::thread::tLock lock(profile.mutex);
+  profile.entries[Key(operation, source_type, destination_type)] = tEntry { &operation, source_type, destination_type, nanoseconds };
+  profile.revision++;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,199 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionCostProfile.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionCostProfile
+ *
+ * \b tConversionCostProfile
+ *
+ * Measured costs of conversion operations for specific source and destination types.
+ * Used by tConversionPathPlanner to prefer the empirically fastest conversion paths.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionCostProfile_h__
+#define __rrlib__rtti_conversion__tConversionCostProfile_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tMutex.h"
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tRegisteredConversionOperation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Profile with measured conversion costs
+/*!
+ * Process-wide profile with measured costs (nanoseconds per conversion) of registered conversion operations
+ * for specific combinations of source and destination types.
+ *
+ * Costs are obtained in a calibration mode (Calibrate()) that micro-benchmarks operations on sample data.
+ * As measurements depend on the machine, profiles can be saved to and loaded from files.
+ * Profile files are text files with one tab-separated entry per line: nanoseconds, operation name, source type name, destination type name.
+ * Entries with unknown operations or types are skipped when loading.
+ */
+class tConversionCostProfile : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Profile entry */
+  struct tEntry
+  {
+    const tRegisteredConversionOperation* operation;
+    tType source_type, destination_type;
+    double nanoseconds;
+  };
+
+  /*!
+   * Measures costs of all registered operations and static casts applicable to sample data - and adds them to profile.
+   * Destination types are the single supported destination types of operations as well as the types of all samples.
+   * Operations that throw on the provided samples are skipped.
+   *
+   * \param samples Sample objects (one per source type; should contain typical data)
+   * \param measurement_duration Minimum duration of each measurement
+   * \return Number of measured combinations of operation, source and destination type
+   */
+  static size_t Calibrate(const std::vector<tTypedConstPointer>& samples, std::chrono::nanoseconds measurement_duration = std::chrono::milliseconds(2));
+
+  /*!
+   * Removes all entries
+   */
+  static void Clear();
+
+  /*!
+   * \param operation Registered conversion operation
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \return Measured cost in nanoseconds. Negative if no cost has been measured for this combination.
+   */
+  static double GetCost(const tRegisteredConversionOperation& operation, const tType& source_type, const tType& destination_type);
+
+  /*!
+   * \return Copy of all entries in profile
+   */
+  static std::vector<tEntry> GetEntries();
+
+  /*!
+   * \return Revision of profile (incremented whenever costs change)
+   */
+  static unsigned int GetRevision()
+  {
+    return Instance().revision.load();
+  }
+
+  /*!
+   * Loads entries from profile file (and adds them to profile)
+   *
+   * \param file_name Name of profile file
+   * \throw Throws std::runtime_error if file cannot be read
+   */
+  static void Load(const std::string& file_name);
+
+  /*!
+   * Saves profile to file
+   *
+   * \param file_name Name of profile file
+   * \throw Throws std::runtime_error if file cannot be written
+   */
+  static void Save(const std::string& file_name);
+
+  /*!
+   * Sets cost of operation for specified types
+   *
+   * \param operation Registered conversion operation
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \param nanoseconds Cost in nanoseconds per conversion
+   */
+  static void SetCost(const tRegisteredConversionOperation& operation, const tType& source_type, const tType& destination_type, double nanoseconds);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Entries (key is computed with Key()) */
+  std::unordered_map<uint64_t, tEntry> entries;
+
+  /*! Incremented whenever costs change */
+  std::atomic<unsigned int> revision;
+
+  /*! Mutex for profile access */
+  rrlib::thread::tMutex mutex;
+
+
+  tConversionCostProfile();
+
+  /*!
+   * \return Single instance of profile
+   */
+  static tConversionCostProfile& Instance();
+
+  /*!
+   * \return Key for entry
+   */
+  static uint64_t Key(const tRegisteredConversionOperation& operation, const tType& source_type, const tType& destination_type)
+  {
+    return (static_cast<uint64_t>(operation.GetHandle()) << 32) | (static_cast<uint64_t>(source_type.GetHandle()) << 16) | destination_type.GetHandle();
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
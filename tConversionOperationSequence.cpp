@@ -32,11 +32,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+#include "rrlib/rtti_conversion/tConversionPathPlanner.h"
+#include "rrlib/rtti_conversion/tPrecompiledConversion.h"
 #include "rrlib/rtti_conversion/tStaticCastOperation.h"
 
 //----------------------------------------------------------------------
@@ -79,7 +82,7 @@ enum tOperationSerializationFlags : uint8_t { cFULL_OPERATION = 1, cPARAMETER =
 tConversionOperationSequence::tConversionOperationSequence(const std::string& first, const std::string& second, const tType& intermediate_type) :
   operations {nullptr, nullptr},
            ambiguous_operation_lookup {false, false},
-           intermediate_type(intermediate_type)
+           intermediate_types {intermediate_type}
 {
   auto find_result = tRegisteredConversionOperation::Find(first);
   operations[0].operation = find_result.first;
@@ -100,22 +103,63 @@ tConversionOperationSequence::tConversionOperationSequence(const std::string& fi
   }
 }
 
+tConversionOperationSequence::tConversionOperationSequence(std::initializer_list<const tRegisteredConversionOperation*> operations, std::initializer_list<tType> intermediate_types) :
+  tConversionOperationSequence()
+{
+  if (operations.size() > cMAX_SIZE)
+  {
+    throw std::invalid_argument("Conversion operation sequences may contain at most " + std::to_string(static_cast<int>(cMAX_SIZE)) + " operations");
+  }
+  if (intermediate_types.size() >= cMAX_SIZE || (intermediate_types.size() && intermediate_types.size() >= operations.size()))
+  {
+    throw std::invalid_argument("Too many intermediate types specified");
+  }
+  size_t index = 0;
+  for (const tRegisteredConversionOperation * operation : operations)
+  {
+    if (!operation)
+    {
+      throw std::invalid_argument("Operations in sequence must not be nullptr");
+    }
+    this->operations[index].operation = operation;
+    index++;
+  }
+  std::copy(intermediate_types.begin(), intermediate_types.end(), this->intermediate_types);
+}
+
 tConversionOperationSequence& tConversionOperationSequence::operator=(const tConversionOperationSequence & other)
 {
-  operations[0].operation = other.operations[0].operation;
-  operations[1].operation = other.operations[1].operation;
-  CopyParameter(other.operations[0].parameter ? *other.operations[0].parameter : tTypedConstPointer(), operations[0].parameter);
-  CopyParameter(other.operations[1].parameter ? *other.operations[1].parameter : tTypedConstPointer(), operations[1].parameter);
+  for (size_t i = 0; i < cMAX_SIZE; i++)
+  {
+    operations[i].operation = other.operations[i].operation;
+    operations[i].SetParameter(other.operations[i].GetParameter());
+  }
+  std::copy(other.intermediate_types, other.intermediate_types + (cMAX_SIZE - 1), intermediate_types);
   memcpy(ambiguous_operation_lookup, other.ambiguous_operation_lookup, sizeof(ambiguous_operation_lookup));
-  intermediate_type = other.intermediate_type;
   return *this;
 }
 
 tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const
 {
+  // Use any conversion function generated ahead of time for exactly this sequence and these types
+  const tPrecompiledConversion* precompiled = (source_type && destination_type) ? tPrecompiledConversion::Find(*this, source_type, destination_type) : nullptr;
+  if (precompiled)
+  {
+    tCompiledConversionOperation result = CompileConversionOptions(allow_reference_to_source, precompiled->GetConversionOption(), nullptr, false);
+    static_cast<tConversionOperationSequence&>(result) = *this;
+    result.function_operations[0].operation = operations[0].operation;
+    return result;
+  }
+
+  if (Size() > 2)
+  {
+    return CompilePipeline(allow_reference_to_source, source_type, destination_type);
+  }
+
   // ############
   // Resolve any ambiguous conversion operations
   // ############
+  const tType& intermediate_type = intermediate_types[0];
   const tRegisteredConversionOperation* first_operation = operations[0].operation;
   if (first_operation && ambiguous_operation_lookup[0])
   {
@@ -124,7 +168,7 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
   const tRegisteredConversionOperation* second_operation = operations[1].operation;
   if (second_operation && ambiguous_operation_lookup[1])
   {
-    second_operation = &tRegisteredConversionOperation::Find(first_operation->Name(), intermediate_type, destination_type);
+    second_operation = &tRegisteredConversionOperation::Find(second_operation->Name(), intermediate_type, destination_type);
   }
 
   // ############
@@ -135,7 +179,7 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
   // Infer any undefined types
   tType type_source = source_type;
   tType type_destination = destination_type;
-  tType type_intermediate = this->intermediate_type;
+  tType type_intermediate = intermediate_type;
   if (!type_source)
   {
     type_source = first_operation ? first_operation->SupportedSourceTypes().single_type : tType();
@@ -162,7 +206,7 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
     }
     if (!type_intermediate)
     {
-      throw std::runtime_error("Intermediate type must be specified");
+      return CompilePlannedSequence(allow_reference_to_source, type_source, type_destination);
     }
   }
 
@@ -171,6 +215,10 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
   const tConversionOption* conversion1 = nullptr;
   const tConversionOption* conversion2 = nullptr;
 
+  // Registered operations that conversion options belong to (nullptr for implicit casts) - and indices of their parameters in this sequence
+  const tRegisteredConversionOperation* option_operations[2] = { first_operation, second_operation };
+  int parameter_indices[2] = { 0, 1 };
+
   // No conversion operation specified: Look for implicit cast
   if ((!first_operation))
   {
@@ -258,6 +306,12 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
         type_intermediate = type_intermediate ? type_intermediate : first_operation->SupportedSourceTypes().single_type;
         temp_conversion_option_1 = tStaticCastOperation::GetImplicitConversionOption(type_source, type_intermediate);
         temp_conversion_option_2 = first_operation->GetConversionOption(type_intermediate, type_destination);
+
+        // registered operation is second
+        option_operations[0] = nullptr;
+        option_operations[1] = first_operation;
+        parameter_indices[0] = -1;
+        parameter_indices[1] = 0;
       }
       if (temp_conversion_option_1.type != tConversionOptionType::NONE && temp_conversion_option_2.type != tConversionOptionType::NONE)
       {
@@ -266,7 +320,7 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
       }
       else
       {
-        throw std::runtime_error("Intermediate type must be specified");
+        return CompilePlannedSequence(allow_reference_to_source, type_source, type_destination);
       }
     }
   }
@@ -275,12 +329,16 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
     throw std::runtime_error("Type " + source_type.GetName() + " cannot be casted to " + destination_type.GetName() + " with the selected operations");
   }
 
+  assert(conversion1 == &temp_conversion_option_1 && ((!conversion2) || conversion2 == &temp_conversion_option_2));
+  tCompiledConversionOperation result = CompileWithParameters(allow_reference_to_source, temp_conversion_option_1, conversion2 ? &temp_conversion_option_2 : nullptr, first_operation == &cFOR_EACH_OPERATION, option_operations, parameter_indices);
+  static_cast<tConversionOperationSequence&>(result) = *this;
+  return result;
+}
 
-  // ############
-  // Compile conversion operation from conversion options
-  // ############
+tCompiledConversionOperation tConversionOperationSequence::CompileConversionOptions(bool allow_reference_to_source, const tConversionOption& first_conversion, const tConversionOption* conversion2, bool for_each)
+{
   typedef tCompiledConversionOperation::tFlag tFlag;
-  assert(conversion1);
+  const tConversionOption* conversion1 = &first_conversion;
   const tConversionOption* last_conversion = conversion2 ? conversion2 : conversion1;
 
   // Do some sanity checks
@@ -291,8 +349,6 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
 
   // Prepare result
   tCompiledConversionOperation result;
-  result.operations[0].operation = first_operation;
-  result.operations[1].operation = second_operation;
   result.destination_type = last_conversion->destination_type;
 
   // Handle special case: only const offsets
@@ -323,23 +379,33 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
   if (conversion1->type == tConversionOptionType::RESULT_REFERENCES_SOURCE_OBJECT && (!conversion2))
   {
     result.conversion_function_first = allow_reference_to_source ? conversion1->final_conversion_function : conversion1->first_conversion_function;
-    result.flags = allow_reference_to_source ? tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY : (tFlag::cRESULT_INDEPENDENT | tFlag::cDO_FINAL_DEEPCOPY_AFTER_FIRST_FUNCTION);
+    result.flags |= allow_reference_to_source ? tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY : (tFlag::cRESULT_INDEPENDENT | tFlag::cDO_FINAL_DEEPCOPY_AFTER_FIRST_FUNCTION);
   }
   // First operation is standard or REFERENCES_SOURCE
   else if (conversion1->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION || conversion1->type == tConversionOptionType::RESULT_REFERENCES_SOURCE_OBJECT)
   {
     result.conversion_function_first = conversion2 ? conversion1->first_conversion_function : conversion1->final_conversion_function;
-    result.flags = tFlag::cRESULT_INDEPENDENT;
+    result.flags |= tFlag::cRESULT_INDEPENDENT;
+    if (conversion1->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION && (!conversion2))
+    {
+      result.batch_conversion_function = conversion1->batch_conversion_function;
+    }
     if (conversion2 && conversion2->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION)
     {
       result.conversion_function_final = conversion2->final_conversion_function;
+      result.batch_conversion_function_final = conversion2->batch_conversion_function;
     }
     else if (conversion2 && conversion2->type == tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT)
     {
-      if (conversion2->const_offset_reference_to_source_object == 0 && conversion2->source_type == conversion2->destination_type && (conversion1->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION || allow_reference_to_source))
+      // (For Each cannot be optimized away: element-wise deep copies are done by tCurrentConversionOperation::ContinueBatch - with a single memcpy for bitwise-copyable elements)
+      if (conversion2->const_offset_reference_to_source_object == 0 && conversion2->source_type == conversion2->destination_type && (conversion1->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION || allow_reference_to_source) && (!for_each))
       {
         result.conversion_function_first =  conversion1->final_conversion_function; // second operation can be optimized away
         result.intermediate_type = result.destination_type;
+        if (conversion1->type == tConversionOptionType::STANDARD_CONVERSION_FUNCTION)
+        {
+          result.batch_conversion_function = conversion1->batch_conversion_function;
+        }
         if (conversion1->type == tConversionOptionType::RESULT_REFERENCES_SOURCE_OBJECT)
         {
           assert(allow_reference_to_source);
@@ -373,7 +439,7 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
       else
       {
         result.flags |= tFlag::cRESULT_REFERENCES_SOURCE_DIRECTLY;
-        result.get_destination_reference_function_first = conversion2->destination_reference_function;
+        result.get_destination_reference_function_first = conversion1->destination_reference_function;  // first function is the variable offset of conversion1 (conversion2 may be nullptr)
         if (conversion2 && conversion2->type == tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT)
         {
           result.fixed_offset_final = conversion2->const_offset_reference_to_source_object;
@@ -409,55 +475,255 @@ tCompiledConversionOperation tConversionOperationSequence::Compile(bool allow_re
     }
   }
 
+  return result;
+}
+
+tCompiledConversionOperation tConversionOperationSequence::CompilePipeline(bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const
+{
+  typedef tCompiledConversionOperation::tFlag tFlag;
+  const size_t size = Size();
+  assert(size > 2 && size <= cMAX_SIZE);
+
+  // ############
+  // Infer types between operations
+  // ############
+  tType types[cMAX_SIZE + 1];
+  types[0] = source_type ? source_type : operations[0].operation->SupportedSourceTypes().single_type;
+  types[size] = destination_type ? destination_type : operations[size - 1].operation->SupportedDestinationTypes().single_type;
+  if (!types[0])
+  {
+    throw std::runtime_error("Source type must be specified");
+  }
+  if (!types[size])
+  {
+    throw std::runtime_error("Destination type must be specified");
+  }
+  for (size_t i = 1; i < size; i++)
+  {
+    types[i] = intermediate_types[i - 1];
+    if (!types[i])
+    {
+      types[i] = operations[i - 1].operation->SupportedDestinationTypes().single_type;
+    }
+    if (!types[i])
+    {
+      types[i] = operations[i].operation->SupportedSourceTypes().single_type;
+    }
+    if (!types[i])
+    {
+      return CompilePlannedSequence(allow_reference_to_source, types[0], types[size]);
+    }
+  }
+
+  // ############
+  // Resolve operations and obtain conversion options
+  // Adjacent const offsets are folded into one
+  // ############
+  struct tStep
+  {
+    tConversionOption option;
+    const tRegisteredConversionOperation* operation;
+    int parameter_index;
+  };
+  tStep steps[cMAX_SIZE];
+  size_t step_count = 0;
+  for (size_t i = 0; i < size; i++)
+  {
+    const tRegisteredConversionOperation* operation = operations[i].operation;
+    if (ambiguous_operation_lookup[i])
+    {
+      operation = &tRegisteredConversionOperation::Find(operation->Name(), types[i], types[i + 1]);
+    }
+    if (operation == &cFOR_EACH_OPERATION)
+    {
+      throw std::runtime_error("ForEach operation is only supported in sequences with up to two operations");
+    }
+    tConversionOption option = operation->GetConversionOption(types[i], types[i + 1]);
+    if (option.type == tConversionOptionType::NONE)
+    {
+      throw std::runtime_error("Type " + types[i].GetName() + " cannot be converted to " + types[i + 1].GetName() + " with operation " + operation->Name());
+    }
+    if (step_count && option.type == tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT && steps[step_count - 1].option.type == tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT)
+    {
+      tConversionOption& previous = steps[step_count - 1].option;
+      previous = tConversionOption(previous.source_type, option.destination_type, previous.const_offset_reference_to_source_object + option.const_offset_reference_to_source_object);
+      continue;
+    }
+    steps[step_count] = tStep { option, operation, static_cast<int>(i) };
+    step_count++;
+  }
+
+  // ############
+  // Compile stages of two steps each
+  // ############
+  std::vector<tCompiledConversionOperation> stages;
+  bool all_stages_reference_directly = true;
+  for (size_t i = 0; i < step_count; i += 2)
+  {
+    tStep& first = steps[i];
+    tStep* second = i + 1 < step_count ? &steps[i + 1] : nullptr;
+    bool last_stage = i + 2 >= step_count;
+
+    // Intermediate objects of the pipeline are temporary: result of last stage may only reference them if all preceding stages reference the source directly
+    bool allow_reference = last_stage ? (allow_reference_to_source && all_stages_reference_directly) : true;
+    const tRegisteredConversionOperation* stage_operations[2] = { first.operation, second ? second->operation : nullptr };
+    int parameter_indices[2] = { first.parameter_index, second ? second->parameter_index : -1 };
+    stages.push_back(CompileWithParameters(allow_reference, first.option, second ? &second->option : nullptr, false, stage_operations, parameter_indices));
+    all_stages_reference_directly &= (stages.back().flags & tFlag::cRESULT_REFERENCES_SOURCE_DIRECTLY) != 0;
+  }
+  if (stages.size() == 1)
+  {
+    // Single stage already carries operations and parameters of its functions (see CompileWithParameters())
+    tCompiledConversionOperation result = std::move(stages[0]);
+    static_cast<tConversionOperationSequence&>(result) = *this;
+    return result;
+  }
+
   // ############
-  // Convert any parameters provided as strings to their required types
+  // Compile pipeline
   // ############
+  tCompiledConversionOperation result;
+  static_cast<tConversionOperationSequence&>(result) = *this;
+  result.function_operations[0].operation = operations[0].operation;
+  result.type_after_first_fixed_offset = types[0];
+  result.intermediate_type = stages[0].destination_type;
+  result.destination_type = stages.back().destination_type;
+  unsigned int last_stage_flags = stages.back().flags;
+  if (allow_reference_to_source && all_stages_reference_directly)
+  {
+    result.get_destination_reference_function_first = &tCompiledConversionOperation::PipelineReferenceFunction;
+    result.flags = tFlag::cRESULT_REFERENCES_SOURCE_DIRECTLY;
+  }
+  else
+  {
+    assert(last_stage_flags & (tFlag::cRESULT_INDEPENDENT | tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY));
+    result.conversion_function_first = &tCompiledConversionOperation::PipelineConversionFunction;
+    result.flags = last_stage_flags & (tFlag::cRESULT_INDEPENDENT | tFlag::cRESULT_REFERENCES_SOURCE_INTERNALLY);
+  }
+  result.pipeline = std::make_shared<const std::vector<tCompiledConversionOperation>>(std::move(stages));
+  return result;
+}
+
+tCompiledConversionOperation tConversionOperationSequence::CompilePlannedSequence(bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const
+{
+  std::vector<const tRegisteredConversionOperation*> required_operations;
+  for (size_t i = 0; i < Size(); i++)
+  {
+    required_operations.push_back(operations[i].operation);
+  }
+  tConversionOperationSequence planned_sequence;
+  try
+  {
+    planned_sequence = tConversionPathPlanner::FindCheapestSequence(source_type, destination_type, required_operations);
+  }
+  catch (const std::runtime_error& e)
+  {
+    throw std::runtime_error("Intermediate type must be specified (no conversion path from " + source_type.GetName() + " to " + destination_type.GetName() + " with the selected operations found)");
+  }
+
+  // Transfer parameters (planned sequence contains operations of this sequence in the same order)
+  for (size_t i = 0, planned_index = 0; i < Size(); i++, planned_index++)
+  {
+    while (planned_sequence.operations[planned_index].operation != operations[i].operation)
+    {
+      planned_index++;
+    }
+    assert(planned_index < planned_sequence.Size());
+    planned_sequence.operations[planned_index].SetParameter(operations[i].GetParameter());
+  }
+
+  tCompiledConversionOperation result = planned_sequence.Compile(allow_reference_to_source, source_type, destination_type);
+  static_cast<tConversionOperationSequence&>(result) = *this;
+  return result;
+}
+
+tCompiledConversionOperation tConversionOperationSequence::CompileWithParameters(bool allow_reference_to_source, tConversionOption& conversion1, tConversionOption* conversion2, bool for_each, const tRegisteredConversionOperation* const* option_operations, const int* parameter_indices) const
+{
+  tSingleOperation compiled_operations[2];
+  uint64_t parameter_state[2] = { 0, 0 };
+  tConversionOption* options[2] = { &conversion1, conversion2 };
   for (size_t i = 0; i < 2; i++)
   {
-    const tRegisteredConversionOperation* operation = i == 0 ? first_operation : second_operation;
-    if (operation && operation->Parameter() && GetParameterValue(i))
+    // ############
+    // Convert any parameters provided as strings to their required types
+    // ############
+    const tRegisteredConversionOperation* operation = option_operations[i];
+    tSingleOperation& result = compiled_operations[i];
+    result.operation = operation;
+    if (operation && operation->Parameter() && parameter_indices[i] >= 0 && GetParameterValue(parameter_indices[i]))
     {
-      const tTypedConstPointer& value = GetParameterValue(i);
+      const tTypedConstPointer& value = GetParameterValue(parameter_indices[i]);
       if (value.GetType() == operation->Parameter().GetType())
       {
-        CopyParameter(value, result.operations[i].parameter);
+        result.SetParameter(value);
       }
       else if (value.GetType() == tDataType<std::string>())
       {
         serialization::tStringInputStream stream(*value.Get<std::string>());
-        result.operations[i].parameter.reset(operation->Parameter().GetType().CreateGenericObject());
-        result.operations[i].parameter->Deserialize(stream);
+        std::unique_ptr<tGenericObject> parameter(operation->Parameter().GetType().CreateGenericObject());
+        parameter->Deserialize(stream);
+        result.SetParameter(*parameter);
       }
       else
       {
         throw std::runtime_error(std::string("Parameter ") + operation->Parameter().GetName() + " has invalid type");
       }
     }
+
+    // ############
+    // Let operation pre-decode its parameter
+    // ############
+    if (operation && options[i])
+    {
+      tConversionOption specialized = operation->SpecializeForParameter(*options[i], result.GetParameter(), parameter_state[i]);
+      if (specialized.type != options[i]->type || specialized.source_type != options[i]->source_type || specialized.destination_type != options[i]->destination_type)
+      {
+        throw std::logic_error(std::string("Operation ") + operation->Name() + " changed conversion option type when specializing for parameter");
+      }
+      *options[i] = specialized;
+    }
   }
 
+  tCompiledConversionOperation result = CompileConversionOptions(allow_reference_to_source, conversion1, conversion2, for_each);
+  for (size_t i = 0; i < 2; i++)
+  {
+    result.function_operations[i] = std::move(compiled_operations[i]);
+    result.parameter_state[i] = parameter_state[i];
+  }
   return result;
 }
 
-void tConversionOperationSequence::CopyParameter(const tTypedConstPointer& source, std::unique_ptr<tGenericObject>& destination)
+void tConversionOperationSequence::tSingleOperation::SetParameter(const tTypedConstPointer& value)
 {
-  if (source)
+  if (!value)
   {
-    if ((!destination) || destination->GetType() != source.GetType())
-    {
-      destination.reset(source.GetType().CreateGenericObject());
-      destination->DeepCopyFrom(source);
-    }
+    inline_parameter_type = tType();
+    parameter.reset();
+    return;
+  }
+
+  const tType& type = value.GetType();
+  if ((type.GetTypeTraits() & trait_flags::cSUPPORTS_BITWISE_COPY) && type.GetSize() <= cINLINE_PARAMETER_SIZE)
+  {
+    memcpy(inline_parameter, value.GetRawDataPointer(), type.GetSize());
+    inline_parameter_type = type;
+    parameter.reset();
   }
   else
   {
-    destination.reset();
+    inline_parameter_type = tType();
+    if ((!parameter) || parameter->GetType() != type)
+    {
+      parameter.reset(type.CreateGenericObject());
+    }
+    parameter->DeepCopyFrom(value);
   }
 }
 
 void tConversionOperationSequence::SetParameterValue(size_t operation_index, const tTypedConstPointer& new_value)
 {
-  assert(operation_index < 2);
-  CopyParameter(new_value, operations[operation_index].parameter);
+  assert(operation_index < cMAX_SIZE);
+  operations[operation_index].SetParameter(new_value);
 }
 
 serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tConversionOperationSequence& sequence)
@@ -483,9 +749,9 @@ serialization::tOutputStream& operator << (serialization::tOutputStream& stream,
       parameter_value.Serialize(stream);
     }
   }
-  if (sequence.Size() > 1)
+  for (size_t i = 1; i < sequence.Size(); i++)
   {
-    stream << sequence.IntermediateType();
+    stream << sequence.IntermediateType(i - 1);
   }
   return stream;
 }
@@ -493,16 +759,16 @@ serialization::tOutputStream& operator << (serialization::tOutputStream& stream,
 serialization::tInputStream& operator >> (serialization::tInputStream& stream, tConversionOperationSequence& sequence)
 {
   size_t size = stream.ReadByte();
-  if (size > 2)
+  if (size > tConversionOperationSequence::cMAX_SIZE)
   {
     throw std::runtime_error("Invalid sequence size");
   }
-  for (size_t i = 0; i < 2; i++)
+  for (size_t i = 0; i < tConversionOperationSequence::cMAX_SIZE; i++)
   {
     if (i >= size)
     {
       sequence.operations[i].operation = nullptr;
-      sequence.operations[i].parameter.reset();
+      sequence.operations[i].SetParameter(tTypedConstPointer());
       sequence.ambiguous_operation_lookup[i] = false;
     }
     else
@@ -528,25 +794,26 @@ serialization::tInputStream& operator >> (serialization::tInputStream& stream, t
       {
         tType type;
         stream >> type;
-        if ((!sequence.operations[i].parameter) || (sequence.operations[i].parameter->GetType() != type))
-        {
-          sequence.operations[i].parameter.reset(type.CreateGenericObject());
-        }
-        sequence.operations[i].parameter->Deserialize(stream);
+        std::unique_ptr<tGenericObject> parameter(type.CreateGenericObject());
+        parameter->Deserialize(stream);
+        sequence.operations[i].SetParameter(*parameter);
       }
       else
       {
-        sequence.operations[i].parameter.reset();
+        sequence.operations[i].SetParameter(tTypedConstPointer());
       }
     }
   }
-  if (size > 1)
+  for (size_t i = 0; i < tConversionOperationSequence::cMAX_SIZE - 1; i++)
   {
-    stream >> sequence.intermediate_type;
-  }
-  else
-  {
-    sequence.intermediate_type = rrlib::rtti::tType();
+    if (i + 1 < size)
+    {
+      stream >> sequence.intermediate_types[i];
+    }
+    else
+    {
+      sequence.intermediate_types[i] = rrlib::rtti::tType();
+    }
   }
   return stream;
 }
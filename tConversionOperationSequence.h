@@ -29,7 +29,7 @@
  *
  * \b tConversionOperationSequence
  *
- * Sequence of conversion operations with a maximum of 2 elements. May be empty.
+ * Sequence of conversion operations with a maximum of cMAX_SIZE elements. May be empty.
  *
  */
 //----------------------------------------------------------------------
@@ -39,6 +39,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <initializer_list>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -65,7 +66,7 @@ class tCompiledConversionOperation;
 //----------------------------------------------------------------------
 //! Sequence of conversion operations
 /*!
- * Sequence of conversion operations with a maximum of 2 elements. May be empty.
+ * Sequence of conversion operations with a maximum of cMAX_SIZE elements. May be empty.
  *
  * Ratio / implementation note:
  *  Advantages compared to using a std::vector: More memory and computationally efficient.
@@ -79,6 +80,9 @@ class tConversionOperationSequence
 //----------------------------------------------------------------------
 public:
 
+  /*! Maximum number of conversion operations in sequence */
+  enum { cMAX_SIZE = 4 };
+
   /*! Constant for sequence with no conversion operations (may be handy if methods return sequences as const reference) */
   static const tConversionOperationSequence cNONE;
 
@@ -90,21 +94,28 @@ public:
   tConversionOperationSequence(const tRegisteredConversionOperation& first, const tRegisteredConversionOperation& second, const tType& intermediate_type = tType()) :
     operations {&first, &second},
              ambiguous_operation_lookup {false, false},
-             intermediate_type(intermediate_type)
+             intermediate_types {intermediate_type}
   {
     assert(first.SupportedDestinationTypes().single_type || second.SupportedSourceTypes().single_type || intermediate_type);
   }
   tConversionOperationSequence(const tRegisteredConversionOperation& first, const tType& intermediate_type = tType()) :
     operations {&first, nullptr},
              ambiguous_operation_lookup {false, false},
-             intermediate_type(intermediate_type)
+             intermediate_types {intermediate_type}
   {}
   tConversionOperationSequence() :
     operations {nullptr, nullptr},
              ambiguous_operation_lookup {false, false},
-             intermediate_type()
+             intermediate_types {}
   {}
 
+  /*!
+   * \param operations Conversion operations in chain (at most cMAX_SIZE)
+   * \param intermediate_types Types after each operation except of the last one. Types can be omitted (empty type) if they are unambiguous - as the operation before has a single destination type or the operation after has a single source type.
+   * \throws Throws std::invalid_argument if there are too many operations or intermediate types
+   */
+  tConversionOperationSequence(std::initializer_list<const tRegisteredConversionOperation*> operations, std::initializer_list<tType> intermediate_types = {});
+
   /*!
    * \param Name of first conversion operation
    * \param Name of second conversion operation (optional)
@@ -114,18 +125,9 @@ public:
   tConversionOperationSequence(const std::string& first, const std::string& second = "", const tType& intermediate_type = tType());
 
   tConversionOperationSequence(const tConversionOperationSequence& other) :
-    operations {other.operations[0].operation, other.operations[1].operation},
-             ambiguous_operation_lookup {other.ambiguous_operation_lookup[0], other.ambiguous_operation_lookup[1]},
-             intermediate_type(other.intermediate_type)
+    tConversionOperationSequence()
   {
-    if (other.operations[0].parameter)
-    {
-      CopyParameter(*other.operations[0].parameter, operations[0].parameter);
-    }
-    if (other.operations[1].parameter)
-    {
-      CopyParameter(*other.operations[1].parameter, operations[1].parameter);
-    }
+    *this = other;
   }
   tConversionOperationSequence& operator=(const tConversionOperationSequence & other);
 
@@ -134,6 +136,9 @@ public:
 
   /*!
    * Compiles conversion operation chain to a single optimized operation.
+   * If a tPrecompiledConversion matches this sequence and the specified types exactly, its function is used.
+   * If intermediate types cannot be inferred, tConversionPathPlanner searches for the cheapest path with the operations of this sequence
+   * (and implicit casts in between).
    *
    * \param allow_reference_to_source May the destination object reference the source? (if not, tConversionResultType is always INDEPENDENT; an additional deep copy operation is possibly inserted)
    * \param source_type Source Type (can be omitted if first operation has fixed source type)
@@ -145,26 +150,36 @@ public:
   /*!
    * Get conversion parameter value
    *
-   * \param operation_index Index of conversion operation in sequence. 0 or 1 are valid indices.
+   * \param operation_index Index of conversion operation in sequence. Indices up to cMAX_SIZE - 1 are valid.
    * \return Pointer to buffer with parameter if it has been specified (otherwise nullptr -> the conversion operation should use a default value)
    */
-  const tTypedConstPointer& GetParameterValue(size_t operation_index) const
+  tTypedConstPointer GetParameterValue(size_t operation_index) const
   {
-    return operations[operation_index].parameter ? static_cast<const tTypedConstPointer&>(*operations[operation_index].parameter) : cNO_PARAMETER_VALUE;
+    return operation_index < cMAX_SIZE ? operations[operation_index].GetParameter() : cNO_PARAMETER_VALUE;
   }
 
   /*!
-   * \return If sequence contains two operations: type after first operation
+   * \return If sequence contains two or more operations: type after first operation
    */
   tType IntermediateType() const
   {
-    return intermediate_type;
+    return intermediate_types[0];
+  }
+
+  /*!
+   * \param index Index of intermediate type. Indices up to cMAX_SIZE - 2 are valid.
+   * \return If sequence contains more than index + 1 operations: type after operation with specified index (may be empty if it is unambiguous)
+   */
+  tType IntermediateType(size_t index) const
+  {
+    assert(index < cMAX_SIZE - 1);
+    return intermediate_types[index];
   }
 
   /*!
    * Set conversion parameter value
    *
-   * \param operation_index Index of conversion operation in sequence. 0 or 1 are valid indices.
+   * \param operation_index Index of conversion operation in sequence. Indices up to cMAX_SIZE - 1 are valid.
    * \param new_value Pointer to buffer with new parameter value. An empty pointer is also valid in order to reset value to default.
    * \throw Throws std::exception on invalid arguments
    */
@@ -173,7 +188,7 @@ public:
   /*!
    * Set conversion parameter value
    *
-   * \param operation_index Index of conversion operation in sequence. 0 or 1 are valid indices.
+   * \param operation_index Index of conversion operation in sequence. Indices up to cMAX_SIZE - 1 are valid.
    * \param new_value Parameter as string. Will be deserialized when operation is compiled.
    * \throw Throws std::exception on invalid arguments
    */
@@ -187,11 +202,16 @@ public:
    */
   unsigned int Size() const
   {
-    return operations[0].operation == nullptr ? 0 : (operations[1].operation == nullptr ? 1 : 2);
+    unsigned int size = 0;
+    while (size < cMAX_SIZE && operations[size].operation)
+    {
+      size++;
+    }
+    return size;
   }
 
   /*!
-   * \param Index of conversion operation in sequence. 0 or 1 are valid indices.
+   * \param Index of conversion operation in sequence. Indices up to cMAX_SIZE - 1 are valid.
    * \return Conversion operation at index. First is name of conversion operation (nullptr if there is no conversion operations at specified index). Second is pointer to conversion operation. May be null, if lookup by name was ambiguous.
    */
   const std::pair<const char*, const tRegisteredConversionOperation*> operator[](size_t index) const
@@ -212,52 +232,140 @@ public:
         return false;
       }
     }
-    return lhs.Size() < 2 || lhs.intermediate_type == rhs.intermediate_type;
+    for (size_t i = 0; i + 1 < lhs.Size(); i++)
+    {
+      if (lhs.intermediate_types[i] != rhs.intermediate_types[i])
+      {
+        return false;
+      }
+    }
+    return true;
   }
 
 //----------------------------------------------------------------------
-// Private fields and methods
+// Protected fields and methods
 //----------------------------------------------------------------------
-private:
+protected:
 
-  friend serialization::tInputStream& operator >> (serialization::tInputStream& stream, tConversionOperationSequence& sequence);
+  /*! Maximum size of parameters that are stored inline (without heap allocation) - if they are bitwise copyable */
+  enum { cINLINE_PARAMETER_SIZE = 16 };
 
   /*! Data on Single operation in sequence */
   struct tSingleOperation
   {
+    /*! Buffer for parameter stored inline (placed first for alignment) */
+    alignas(16) char inline_parameter[cINLINE_PARAMETER_SIZE];
+
     /*! Stores operations */
     const tRegisteredConversionOperation* operation;
 
-    /*! Any parameter of operation */
+    /*! Any parameter of operation that is not stored inline */
     std::unique_ptr<tGenericObject> parameter;
 
-    tSingleOperation(const tRegisteredConversionOperation* operation) : operation(operation), parameter() {}
+    /*! Type of parameter stored inline (empty type if there is no such parameter) */
+    tType inline_parameter_type;
+
+    tSingleOperation(const tRegisteredConversionOperation* operation = nullptr) : operation(operation), parameter(), inline_parameter_type() {}
+
+    tSingleOperation(const tSingleOperation& other) : tSingleOperation(other.operation)
+    {
+      SetParameter(other.GetParameter());
+    }
+    tSingleOperation& operator=(const tSingleOperation& other)
+    {
+      if (this != &other)
+      {
+        operation = other.operation;
+        SetParameter(other.GetParameter());
+      }
+      return *this;
+    }
+
+    tSingleOperation(tSingleOperation && other) = default;
+    tSingleOperation& operator=(tSingleOperation && other) = default;
+
+    /*!
+     * \return Parameter value (empty pointer if no parameter is set)
+     */
+    tTypedConstPointer GetParameter() const
+    {
+      if (inline_parameter_type)
+      {
+        return tTypedConstPointer(inline_parameter, inline_parameter_type);
+      }
+      return parameter ? static_cast<const tTypedConstPointer&>(*parameter) : cNO_PARAMETER_VALUE;
+    }
+
+    /*!
+     * Sets parameter (bitwise copyable values up to cINLINE_PARAMETER_SIZE bytes are stored inline)
+     *
+     * \param value New value (may be empty, then parameter will be reset)
+     */
+    void SetParameter(const tTypedConstPointer& value);
 
     bool operator==(const tSingleOperation& other) const
     {
-      return operation == other.operation && (((!parameter) && (!other.parameter)) || (parameter && other.parameter && parameter->Equals(*other.parameter)));
+      tTypedConstPointer value = GetParameter(), other_value = other.GetParameter();
+      return operation == other.operation && (((!value) && (!other_value)) || (value && other_value && value.GetType() == other_value.GetType() && value.Equals(other_value)));
     }
   };
 
+  /*! Empty pointer - returned for parameter values that have not been set */
+  static const tTypedConstPointer cNO_PARAMETER_VALUE;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend serialization::tInputStream& operator >> (serialization::tInputStream& stream, tConversionOperationSequence& sequence);
+
   /*! Operations in sequence */
-  tSingleOperation operations[2];
+  tSingleOperation operations[cMAX_SIZE];
 
   /*! Whether name lookup of operation was ambiguous (=> only name of operation is valid; => when compiling, this ambiguity needs to be resolved) */
-  bool ambiguous_operation_lookup[2];  // extra array to reduce memory overhead
+  bool ambiguous_operation_lookup[cMAX_SIZE];  // extra array to reduce memory overhead
 
-  /*! If sequence contains two operations: type after first operation (may be ambiguous otherwise) */
-  tType intermediate_type;
+  /*! Types after each operation except of the last one (may be empty if unambiguous) */
+  tType intermediate_types[cMAX_SIZE - 1];
 
-  /*! Empty pointer - returned for parameter values that have not been set */
-  static const tTypedConstPointer cNO_PARAMETER_VALUE;
+  /*!
+   * Compiles conversion operation from one or two conversion options
+   *
+   * \param allow_reference_to_source May the destination object reference the source?
+   * \param conversion1 First conversion option
+   * \param conversion2 Second conversion option (nullptr if there is none)
+   * \param for_each Whether first conversion option is the For Each operation
+   * \return Compiled conversion operation (without sequence and parameters)
+   */
+  static tCompiledConversionOperation CompileConversionOptions(bool allow_reference_to_source, const tConversionOption& conversion1, const tConversionOption* conversion2, bool for_each);
+
+  /*!
+   * Compiles sequence with more than two operations to pipeline of compiled two-step operations
+   * (parameters are the same as for Compile())
+   */
+  tCompiledConversionOperation CompilePipeline(bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const;
+
+  /*!
+   * Compiles cheapest sequence that tConversionPathPlanner finds with the operations of this sequence (and implicit casts in between).
+   * Used if intermediate types cannot be inferred.
+   * (parameters are the same as for Compile() - but source and destination type must be set)
+   */
+  tCompiledConversionOperation CompilePlannedSequence(bool allow_reference_to_source, const tType& source_type, const tType& destination_type) const;
 
   /*!
-   * Copies parameter
+   * Compiles conversion options with the parameters of this sequence:
+   * Converts parameters to their required types, lets registered operations specialize their options for them and compiles the options.
    *
-   * \param source Source parameter (may be nullptr, then destination will be reset)
-   * \param destination Destination parameter
+   * \param allow_reference_to_source Whether result may reference source object
+   * \param conversion1 First conversion option (may be modified by specialization)
+   * \param conversion2 Second conversion option (optional - may be modified by specialization)
+   * \param for_each Whether first operation is For Each
+   * \param option_operations Registered operations of the two conversion options (nullptr for implicit casts or if there is no option)
+   * \param parameter_indices Indices of the options' parameters in this sequence (-1 if there is no such parameter)
+   * \return Compiled conversion operation (with operations and parameters of its functions - but without sequence)
    */
-  static void CopyParameter(const tTypedConstPointer& source, std::unique_ptr<tGenericObject>& destination);
+  tCompiledConversionOperation CompileWithParameters(bool allow_reference_to_source, tConversionOption& conversion1, tConversionOption* conversion2, bool for_each, const tRegisteredConversionOperation* const* option_operations, const int* parameter_indices) const;
 };
 
 
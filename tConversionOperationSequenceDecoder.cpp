@@ -0,0 +1,133 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionOperationSequenceDecoder.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequenceDecoder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequenceEncoder.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! Maximum number of bytes of a varint encoding 32 bit values */
+const unsigned int cMAX_VARINT_SIZE = 5;
+
+tConversionOperationSequenceDecoder::tConversionOperationSequenceDecoder() :
+  sequences(),
+  uncached_sequence()
+{}
+
+const tConversionOperationSequence& tConversionOperationSequenceDecoder::Decode(serialization::tInputStream& stream)
+{
+  uint32_t tag = ReadVarint(stream);
+  if (tag >= tConversionOperationSequenceEncoder::cFIRST_ID)
+  {
+    size_t id = tag - tConversionOperationSequenceEncoder::cFIRST_ID;
+    if (id >= sequences.size())
+    {
+      throw std::runtime_error("Invalid conversion operation sequence id");
+    }
+    return sequences[id];
+  }
+  if (tag == tConversionOperationSequenceEncoder::cNEW_SEQUENCE)
+  {
+    if (sequences.size() >= tConversionOperationSequenceEncoder::cMAX_DICTIONARY_SIZE)
+    {
+      throw std::runtime_error("Too many conversion operation sequences");
+    }
+    tConversionOperationSequence sequence;
+    stream >> sequence;
+    sequences.push_back(std::move(sequence));
+    return sequences.back();
+  }
+  stream >> uncached_sequence;
+  return uncached_sequence;
+}
+
+void tConversionOperationSequenceDecoder::Reset()
+{
+  sequences.clear();
+}
+
+uint32_t tConversionOperationSequenceDecoder::ReadVarint(serialization::tInputStream& stream)
+{
+  uint32_t result = 0;
+  for (unsigned int i = 0; i < cMAX_VARINT_SIZE; i++)
+  {
+    uint8_t byte = stream.ReadByte();
+    result |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+    if (!(byte & 0x80))
+    {
+      return result;
+    }
+  }
+  throw std::runtime_error("Invalid varint");
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,128 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionOperationSequenceDecoder.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionOperationSequenceDecoder
+ *
+ * \b tConversionOperationSequenceDecoder
+ *
+ * Reads conversion operation sequences written by tConversionOperationSequenceEncoder.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionOperationSequenceDecoder_h__
+#define __rrlib__rtti_conversion__tConversionOperationSequenceDecoder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequence.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Decoder for compactly encoded conversion operation sequences
+/*!
+ * Reads conversion operation sequences written by tConversionOperationSequenceEncoder.
+ * Sequences are deserialized (and their operations looked up) only once.
+ * Ids of repeated sequences are resolved with a table indexed by id.
+ *
+ * A decoder must be used with exactly one stream - see tConversionOperationSequenceEncoder.
+ * Decoders are not thread-safe.
+ */
+class tConversionOperationSequenceDecoder : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tConversionOperationSequenceDecoder();
+
+  /*!
+   * Reads sequence from stream
+   *
+   * \param stream Stream to read from
+   * \return Sequence read (reference remains valid until next call to Decode() or Reset())
+   * \throw Throws std::runtime_error if stream contains invalid data
+   */
+  const tConversionOperationSequence& Decode(serialization::tInputStream& stream);
+
+  /*!
+   * Clears table with sequences (e.g. when stream is reset)
+   */
+  void Reset();
+
+  /*!
+   * Reads varint as written by tConversionOperationSequenceEncoder::WriteVarint()
+   *
+   * \param stream Stream to read from
+   * \return Value read
+   * \throw Throws std::runtime_error if varint is too long
+   */
+  static uint32_t ReadVarint(serialization::tInputStream& stream);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Sequences in dictionary of encoder (index is id) */
+  std::vector<tConversionOperationSequence> sequences;
+
+  /*! Last sequence read that was not added to dictionary */
+  tConversionOperationSequence uncached_sequence;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,147 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionOperationSequenceEncoder.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequenceEncoder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+inline void HashCombine(size_t& seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+}
+
+tConversionOperationSequenceEncoder::tConversionOperationSequenceEncoder() :
+  sequences(),
+  index()
+{}
+
+void tConversionOperationSequenceEncoder::Encode(serialization::tOutputStream& stream, const tConversionOperationSequence& sequence)
+{
+  size_t hash = Hash(sequence);
+  auto range = index.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (sequences[it->second] == sequence)
+    {
+      WriteVarint(stream, it->second + cFIRST_ID);
+      return;
+    }
+  }
+
+  if (sequences.size() < cMAX_DICTIONARY_SIZE)
+  {
+    index.emplace(hash, static_cast<uint32_t>(sequences.size()));
+    sequences.push_back(sequence);
+    WriteVarint(stream, cNEW_SEQUENCE);
+  }
+  else
+  {
+    WriteVarint(stream, cUNCACHED_SEQUENCE);
+  }
+  stream << sequence;
+}
+
+void tConversionOperationSequenceEncoder::Reset()
+{
+  sequences.clear();
+  index.clear();
+}
+
+void tConversionOperationSequenceEncoder::WriteVarint(serialization::tOutputStream& stream, uint32_t value)
+{
+  while (value >= 0x80)
+  {
+    stream.WriteByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  stream.WriteByte(static_cast<uint8_t>(value));
+}
+
+size_t tConversionOperationSequenceEncoder::Hash(const tConversionOperationSequence& sequence)
+{
+  size_t hash = sequence.Size();
+  for (size_t i = 0; i < sequence.Size(); i++)
+  {
+    HashCombine(hash, reinterpret_cast<size_t>(sequence[i].first));  // operation names are not copied - so pointer is sufficient
+  }
+  for (size_t i = 1; i < sequence.Size(); i++)
+  {
+    HashCombine(hash, sequence.IntermediateType(i - 1).GetHandle());
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
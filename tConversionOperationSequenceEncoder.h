@@ -0,0 +1,147 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionOperationSequenceEncoder.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionOperationSequenceEncoder
+ *
+ * \b tConversionOperationSequenceEncoder
+ *
+ * Writes conversion operation sequences to a stream in compact form.
+ * Each distinct sequence is written once - repeated sequences are written as a small varint id.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionOperationSequenceEncoder_h__
+#define __rrlib__rtti_conversion__tConversionOperationSequenceEncoder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequence.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Compact encoder for conversion operation sequences
+/*!
+ * Writes conversion operation sequences to a stream in compact form.
+ * Encoder maintains a dictionary of the sequences written so far:
+ * Each distinct sequence is written once (in the format of operator <<) and assigned the next id.
+ * Repeated sequences are written as their id (varint - typically a single byte).
+ *
+ * An encoder must be used with exactly one stream (e.g. the stream of a network connection) - and the sequences
+ * must be read with exactly one tConversionOperationSequenceDecoder. If the stream is reset, both need to be reset as well.
+ * Encoders are not thread-safe.
+ */
+class tConversionOperationSequenceEncoder : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of sequences in dictionary (further sequences are written completely each time) */
+  enum { cMAX_DICTIONARY_SIZE = 65536 };
+
+  /*! Varint tags preceding encoded sequences (ids of sequences in dictionary are encoded as id + cFIRST_ID) */
+  enum tTag
+  {
+    cNEW_SEQUENCE,      //!< Sequence follows and is added to dictionary
+    cUNCACHED_SEQUENCE, //!< Sequence follows and is not added to dictionary (dictionary is full)
+    cFIRST_ID
+  };
+
+  tConversionOperationSequenceEncoder();
+
+  /*!
+   * Writes sequence to stream
+   *
+   * \param stream Stream to write to
+   * \param sequence Sequence to write
+   */
+  void Encode(serialization::tOutputStream& stream, const tConversionOperationSequence& sequence);
+
+  /*!
+   * Clears dictionary (e.g. when stream is reset)
+   */
+  void Reset();
+
+  /*!
+   * Writes unsigned integer as varint (7 bits per byte, least significant first)
+   *
+   * \param stream Stream to write to
+   * \param value Value to write
+   */
+  static void WriteVarint(serialization::tOutputStream& stream, uint32_t value);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Sequences in dictionary (index is id) */
+  std::vector<tConversionOperationSequence> sequences;
+
+  /*! Index of dictionary (key is hash of sequence - see Hash(); value is id) */
+  std::unordered_multimap<size_t, uint32_t> index;
+
+
+  /*!
+   * \return Hash value of sequence (parameters are not considered)
+   */
+  static size_t Hash(const tConversionOperationSequence& sequence);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
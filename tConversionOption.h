@@ -77,6 +77,7 @@ enum class tConversionOptionType
    * Computational overhead:
    * - Single/final operation: a function pointer call + copying to the destination object.
    * - First operation in sequence: a function pointer call + creating and copying to intermediate object on the stack (expensive for destination types which allocate memory internally)
+   * - Batches (single operation): one function pointer call per batch if operation provides a batch conversion function
    */
   STANDARD_CONVERSION_FUNCTION,
 
@@ -140,6 +141,19 @@ struct tConversionOption
    */
   typedef tTypedConstPointer(*tGetDestinationReferenceFunction)(const tTypedConstPointer& source_object, const tCurrentConversionOperation& operation);
 
+  /*!
+   * Function pointer for converting multiple objects at once (optional; only used with STANDARD_CONVERSION_FUNCTION as single operation)
+   * Converts 'count' objects - each source object to the destination object with the same index.
+   *
+   * \param source Pointer to first source object
+   * \param source_stride Offset between two source objects in bytes
+   * \param destination Pointer to first destination object
+   * \param destination_stride Offset between two destination objects in bytes
+   * \param count Number of objects to convert
+   * \param operation Provides access to current conversion operation (e.g. flags and parameters). Continue() must not be called.
+   */
+  typedef void (*tBatchConversionFunction)(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation& operation);
+
   /*! Source and destination types */
   rrlib::rtti::tType source_type, destination_type;
 
@@ -166,15 +180,19 @@ struct tConversionOption
     tGetDestinationReferenceFunction destination_reference_function;
   };
 
+  /*! Optional function for converting multiple objects at once. If nullptr, batches are converted calling final_conversion_function for each object. */
+  tBatchConversionFunction batch_conversion_function;
+
   /*!
    * Constructor for STANDARD_CONVERSION_FUNCTION and RESULT_REFERENCES_SOURCE_OBJECT
    */
-  constexpr tConversionOption(const rrlib::rtti::tType& source_type, const rrlib::rtti::tType& destination_type, bool destination_references_source, tConversionFunction first_conversion_function, tConversionFunction final_conversion_function) :
+  constexpr tConversionOption(const rrlib::rtti::tType& source_type, const rrlib::rtti::tType& destination_type, bool destination_references_source, tConversionFunction first_conversion_function, tConversionFunction final_conversion_function, tBatchConversionFunction batch_conversion_function = nullptr) :
     source_type(source_type),
     destination_type(destination_type),
     type(destination_references_source ? tConversionOptionType::RESULT_REFERENCES_SOURCE_OBJECT : tConversionOptionType::STANDARD_CONVERSION_FUNCTION),
     first_conversion_function(first_conversion_function),
-    final_conversion_function(final_conversion_function)
+    final_conversion_function(final_conversion_function),
+    batch_conversion_function(batch_conversion_function)
   {}
 
   /*!
@@ -185,7 +203,8 @@ struct tConversionOption
     destination_type(destination_type),
     type(tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT),
     const_offset_reference_to_source_object(const_offset_reference_to_source_object),
-    final_conversion_function(nullptr)
+    final_conversion_function(nullptr),
+    batch_conversion_function(nullptr)
   {}
 
   /*!
@@ -196,7 +215,8 @@ struct tConversionOption
     destination_type(destination_type),
     type(tConversionOptionType::VARIABLE_OFFSET_REFERENCE_TO_SOURCE_OBJECT),
     first_conversion_function(first_conversion_function),
-    destination_reference_function(destination_reference_function)
+    destination_reference_function(destination_reference_function),
+    batch_conversion_function(nullptr)
   {}
 
   /*!
@@ -207,7 +227,8 @@ struct tConversionOption
     destination_type(),
     type(tConversionOptionType::NONE),
     const_offset_reference_to_source_object(0),
-    final_conversion_function(nullptr)
+    final_conversion_function(nullptr),
+    batch_conversion_function(nullptr)
   {}
 };
 
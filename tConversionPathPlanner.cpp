@@ -0,0 +1,432 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionPathPlanner.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionPathPlanner.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionCostProfile.h"
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Estimated costs of conversion option types in nanoseconds (see tConversionOptionType for the computational overhead of each type) */
+const double cCOST_CONST_OFFSET = 1;
+const double cCOST_VARIABLE_OFFSET = 2;
+const double cCOST_RESULT_REFERENCES_SOURCE = 5;
+const double cCOST_STANDARD_CONVERSION_FUNCTION = 10;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tConversionPathPlanner::tConversionPathPlanner() :
+  revision(0),
+  profile_revision(0),
+  graph_valid(false),
+  estimate_scale(1)
+{}
+
+double tConversionPathPlanner::EstimateCost(const tConversionOption& option)
+{
+  switch (option.type)
+  {
+  case tConversionOptionType::CONST_OFFSET_REFERENCE_TO_SOURCE_OBJECT:
+    return cCOST_CONST_OFFSET;
+  case tConversionOptionType::VARIABLE_OFFSET_REFERENCE_TO_SOURCE_OBJECT:
+    return cCOST_VARIABLE_OFFSET;
+  case tConversionOptionType::RESULT_REFERENCES_SOURCE_OBJECT:
+    return cCOST_RESULT_REFERENCES_SOURCE;
+  case tConversionOptionType::STANDARD_CONVERSION_FUNCTION:
+    return cCOST_STANDARD_CONVERSION_FUNCTION;
+  default:
+    assert(false && "Invalid conversion option");
+    return std::numeric_limits<double>::max();
+  }
+}
+
+tConversionOperationSequence tConversionPathPlanner::FindCheapestSequence(const tType& source_type, const tType& destination_type)
+{
+  if (source_type == destination_type)
+  {
+    return tConversionOperationSequence();
+  }
+
+  tConversionPathPlanner& planner = Instance();
+  rrlib::thread::tLock lock(planner.mutex);
+  planner.UpdateIfOutdated();
+
+  uint32_t key = (static_cast<uint32_t>(source_type.GetHandle()) << 16) | destination_type.GetHandle();
+  auto it = planner.paths.find(key);
+  if (it == planner.paths.end())
+  {
+    it = planner.paths.emplace(key, planner.Search(source_type, destination_type)).first;
+  }
+  return ToSequence(it->second, source_type, destination_type);
+}
+
+tConversionOperationSequence tConversionPathPlanner::FindCheapestSequence(const tType& source_type, const tType& destination_type, const std::vector<const tRegisteredConversionOperation*>& required_operations)
+{
+  tConversionPathPlanner& planner = Instance();
+  rrlib::thread::tLock lock(planner.mutex);
+  planner.UpdateIfOutdated();
+  tPath path = required_operations.size() <= tConversionOperationSequence::cMAX_SIZE ? planner.Search(source_type, destination_type, &required_operations) : tPath { {}, false };
+  if (path.found && path.edges.empty())
+  {
+    return tConversionOperationSequence();
+  }
+  return ToSequence(path, source_type, destination_type);
+}
+
+tConversionOperationSequence tConversionPathPlanner::ToSequence(const tPath& path, const tType& source_type, const tType& destination_type)
+{
+  if (!path.found)
+  {
+    throw std::runtime_error("No conversion path from " + source_type.GetName() + " to " + destination_type.GetName() + " found");
+  }
+
+  const std::vector<tEdge>& e = path.edges;
+  switch (e.size())
+  {
+  case 1:
+    return tConversionOperationSequence({ e[0].operation });
+  case 2:
+    return tConversionOperationSequence({ e[0].operation, e[1].operation }, { e[0].destination_type });
+  case 3:
+    return tConversionOperationSequence({ e[0].operation, e[1].operation, e[2].operation }, { e[0].destination_type, e[1].destination_type });
+  case 4:
+    return tConversionOperationSequence({ e[0].operation, e[1].operation, e[2].operation, e[3].operation }, { e[0].destination_type, e[1].destination_type, e[2].destination_type });
+  default:
+    assert(false && "Invalid path length");
+    throw std::runtime_error("Invalid path length");
+  }
+}
+
+void tConversionPathPlanner::GetEdges(const tType& type, const tType& destination_type, unsigned int depth, std::vector<tEdge>& edges) const
+{
+  if (type.GetHandle() < static_cast_edges.size())
+  {
+    for (const tStaticCastEdge & edge : static_cast_edges[type.GetHandle()])
+    {
+      edges.push_back(tEdge { edge.operation, edge.option->destination_type, GetCost(*edge.operation, *edge.option) });
+    }
+  }
+
+  auto add_operation_edges = [&](const tRegisteredConversionOperation * operation)
+  {
+    // Encoded data must not be decoded as another type: decoding operations only start paths, encoding operations only end them
+    tRegisteredConversionOperation::tPathPlanningRole role = operation->PathPlanningRole();
+    if (role == tRegisteredConversionOperation::tPathPlanningRole::DECODING && depth > 0)
+    {
+      return;
+    }
+    tType candidates[2];
+    if (operation->SupportedDestinationTypes().filter == tSupportedTypeFilter::SINGLE)
+    {
+      candidates[0] = operation->SupportedDestinationTypes().single_type;
+    }
+    else
+    {
+      candidates[0] = destination_type;
+      candidates[1] = type.IsListType() ? type.GetElementType() : tType();
+    }
+    for (const tType & candidate : candidates)
+    {
+      if (candidate && candidate != type && (role != tRegisteredConversionOperation::tPathPlanningRole::ENCODING || candidate == destination_type))
+      {
+        tConversionOption option = operation->GetConversionOption(type, candidate);
+        if (option.type != tConversionOptionType::NONE)
+        {
+          edges.push_back(tEdge { operation, candidate, GetCost(*operation, option) });
+        }
+      }
+    }
+  };
+  if (type.GetHandle() < operations_by_source_type.size())
+  {
+    for (auto operation : operations_by_source_type[type.GetHandle()])
+    {
+      add_operation_edges(operation);
+    }
+  }
+  for (auto operation : generic_operations)
+  {
+    add_operation_edges(operation);
+  }
+}
+
+void tConversionPathPlanner::GetEdges(const tType& type, const tType& destination_type, const tRegisteredConversionOperation* required_operation, std::vector<tEdge>& edges) const
+{
+  if (type.GetHandle() < static_cast_edges.size())
+  {
+    for (const tStaticCastEdge & edge : static_cast_edges[type.GetHandle()])
+    {
+      if (tStaticCastOperation::GetImplicitConversionOption(type, edge.option->destination_type).type != tConversionOptionType::NONE)
+      {
+        edges.push_back(tEdge { edge.operation, edge.option->destination_type, GetCost(*edge.operation, *edge.option) });
+      }
+    }
+  }
+
+  if (required_operation)
+  {
+    // Required operations are not restricted by their path planning role - they were selected explicitly
+    tType candidates[2];
+    if (required_operation->SupportedDestinationTypes().filter == tSupportedTypeFilter::SINGLE)
+    {
+      candidates[0] = required_operation->SupportedDestinationTypes().single_type;
+    }
+    else
+    {
+      candidates[0] = destination_type;
+      candidates[1] = type.IsListType() ? type.GetElementType() : tType();
+    }
+    for (const tType & candidate : candidates)
+    {
+      if (candidate)
+      {
+        tConversionOption option = required_operation->GetConversionOption(type, candidate);
+        if (option.type != tConversionOptionType::NONE)
+        {
+          edges.push_back(tEdge { required_operation, candidate, GetCost(*required_operation, option) });
+        }
+      }
+    }
+    if (required_operation == &tStaticCastOperation::GetInstance() && type.GetHandle() < static_cast_edges.size())
+    {
+      for (const tStaticCastEdge & edge : static_cast_edges[type.GetHandle()])
+      {
+        edges.push_back(tEdge { edge.operation, edge.option->destination_type, GetCost(*edge.operation, *edge.option) });
+      }
+    }
+  }
+}
+
+double tConversionPathPlanner::FitEstimateScale()
+{
+  double measured_sum = 0, estimated_sum = 0;
+  for (const tConversionCostProfile::tEntry & entry : tConversionCostProfile::GetEntries())
+  {
+    tConversionOption option = entry.operation->GetConversionOption(entry.source_type, entry.destination_type);
+    if (option.type != tConversionOptionType::NONE)
+    {
+      measured_sum += entry.nanoseconds;
+      estimated_sum += EstimateCost(option);
+    }
+  }
+  return (estimated_sum > 0 && measured_sum > 0) ? measured_sum / estimated_sum : 1;
+}
+
+double tConversionPathPlanner::GetCost(const tRegisteredConversionOperation& operation, const tConversionOption& option) const
+{
+  double measured_cost = tConversionCostProfile::GetCost(operation, option.source_type, option.destination_type);
+  return measured_cost >= 0 ? measured_cost : EstimateCost(option) * estimate_scale;
+}
+
+tConversionPathPlanner& tConversionPathPlanner::Instance()
+{
+  static tConversionPathPlanner instance;
+  return instance;
+}
+
+tConversionPathPlanner::tPath tConversionPathPlanner::Search(const tType& source_type, const tType& destination_type, const std::vector<const tRegisteredConversionOperation*>* required_operations) const
+{
+  // States of search are (type, number of operations, number of required operations in path) - as paths are limited to tConversionOperationSequence::cMAX_SIZE operations
+  struct tState
+  {
+    tEdge edge;  // edge leading to this state (operation is nullptr for start state)
+    int previous_state;
+    double cost;
+    unsigned int depth;
+    unsigned int required_count;
+  };
+  const size_t required_size = required_operations ? required_operations->size() : 0;
+  std::vector<tState> states;
+  std::unordered_map<uint32_t, double> best_costs;
+  typedef std::pair<double, size_t> tQueueEntry;  // cost, state index
+  std::priority_queue<tQueueEntry, std::vector<tQueueEntry>, std::greater<tQueueEntry>> queue;
+
+  states.push_back(tState { tEdge { nullptr, source_type, 0 }, -1, 0, 0, 0 });
+  queue.emplace(0, 0);
+  std::vector<tEdge> edges;
+  while (!queue.empty())
+  {
+    tQueueEntry entry = queue.top();
+    queue.pop();
+    const tState state = states[entry.second];  // copy (states may grow below)
+    if (state.depth && best_costs[(static_cast<uint32_t>(state.edge.destination_type.GetHandle()) << 8) | (state.depth << 4) | state.required_count] < state.cost)
+    {
+      continue;  // cheaper path to this state has been found meanwhile
+    }
+    if (state.edge.destination_type == destination_type && state.required_count == required_size)
+    {
+      tPath path;
+      path.found = true;
+      for (int i = static_cast<int>(entry.second); states[i].previous_state >= 0; i = states[i].previous_state)
+      {
+        path.edges.insert(path.edges.begin(), states[i].edge);
+      }
+      return path;
+    }
+    if (state.depth + std::max<size_t>(required_size - state.required_count, 1) > tConversionOperationSequence::cMAX_SIZE)
+    {
+      continue;  // no room for (remaining required) operations
+    }
+
+    edges.clear();
+    const tRegisteredConversionOperation* next_required_operation = state.required_count < required_size ? (*required_operations)[state.required_count] : nullptr;
+    if (required_operations)
+    {
+      GetEdges(state.edge.destination_type, destination_type, next_required_operation, edges);
+    }
+    else
+    {
+      GetEdges(state.edge.destination_type, destination_type, state.depth, edges);
+    }
+    for (const tEdge & edge : edges)
+    {
+      double cost = state.cost + edge.cost;
+      unsigned int required_count = state.required_count + (next_required_operation && edge.operation == next_required_operation ? 1 : 0);
+      uint32_t key = (static_cast<uint32_t>(edge.destination_type.GetHandle()) << 8) | ((state.depth + 1) << 4) | required_count;
+      auto best = best_costs.find(key);
+      if (best == best_costs.end() || cost < best->second)
+      {
+        best_costs[key] = cost;
+        states.push_back(tState { edge, static_cast<int>(entry.second), cost, state.depth + 1, required_count });
+        queue.emplace(cost, states.size() - 1);
+      }
+    }
+  }
+
+  tPath path;
+  path.found = false;
+  return path;
+}
+
+void tConversionPathPlanner::UpdateGraph()
+{
+  static_cast_edges.clear();
+  operations_by_source_type.clear();
+  generic_operations.clear();
+  const tRegisteredConversionOperation::tRegisteredOperations& registered = tRegisteredConversionOperation::GetRegisteredOperations();
+
+  const tRegisteredConversionOperation* static_cast_operation = &tStaticCastOperation::GetInstance();
+  for (const tConversionOptionStaticCast * static_cast_option : registered.static_cast_list.GetSnapshot())
+  {
+    const tConversionOption& option = static_cast_option->conversion_option;
+    size_t handle = option.source_type.GetHandle();
+    if (static_cast_edges.size() <= handle)
+    {
+      static_cast_edges.resize(handle + 1);
+    }
+    static_cast_edges[handle].push_back(tStaticCastEdge { static_cast_operation, &option });
+  }
+
+  for (const tRegisteredConversionOperation * operation : registered.operation_list.GetSnapshot())
+  {
+    if (operation == static_cast_operation || operation->PathPlanningRole() == tRegisteredConversionOperation::tPathPlanningRole::EXCLUDED)
+    {
+      continue;
+    }
+    if (operation->SupportedSourceTypes().filter == tSupportedTypeFilter::SINGLE)
+    {
+      size_t handle = operation->SupportedSourceTypes().single_type.GetHandle();
+      if (operations_by_source_type.size() <= handle)
+      {
+        operations_by_source_type.resize(handle + 1);
+      }
+      operations_by_source_type[handle].push_back(operation);
+    }
+    else
+    {
+      generic_operations.push_back(operation);
+    }
+  }
+  graph_valid = true;
+}
+
+void tConversionPathPlanner::UpdateIfOutdated()
+{
+  unsigned int current_revision = tRegisteredConversionOperation::GetRegisteredOperations().revision.load();
+  unsigned int current_profile_revision = tConversionCostProfile::GetRevision();
+  if ((!graph_valid) || revision != current_revision)
+  {
+    paths.clear();
+    revision = current_revision;
+    UpdateGraph();
+  }
+  if (profile_revision != current_profile_revision)
+  {
+    paths.clear();
+    profile_revision = current_profile_revision;
+    estimate_scale = FitEstimateScale();
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,265 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionPathPlanner.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionPathPlanner
+ *
+ * \b tConversionPathPlanner
+ *
+ * Finds the cheapest sequence of registered conversion operations and static casts
+ * that converts between two arbitrary types.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionPathPlanner_h__
+#define __rrlib__rtti_conversion__tConversionPathPlanner_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tMutex.h"
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequence.h"
+#include "rrlib/rtti_conversion/tConversionOption.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Planner for conversion paths
+/*!
+ * Views types as nodes of a graph whose edges are the registered static casts and conversion operations
+ * (derived from their supported source and destination types).
+ * Finds the cheapest path between two types with a cost-weighted shortest path search (Dijkstra).
+ * Edge costs are taken from tConversionCostProfile if they have been measured - and are estimated
+ * from the types of the conversion options otherwise (see EstimateCost()).
+ * So that estimates are comparable to measured costs, they are scaled by a factor fitted to the profile's entries
+ * (ratio of the sum of measured costs to the sum of the estimates for the same conversion options).
+ *
+ * Paths contain at most tConversionOperationSequence::cMAX_SIZE operations.
+ * Operations with multiple supported destination types (e.g. "String Deserialization") only lead to the
+ * requested destination type or - for list types - to their element type.
+ * Only static casts and operations that are actual conversions are considered (see tRegisteredConversionOperation::PathPlanningRole()):
+ * Operations whose result depends on a parameter are excluded - e.g. For Each and "[]" (which would silently select element 0).
+ * Encoding operations ("ToString", "Binary Serialization") may only end paths and decoding operations ("String Deserialization",
+ * "Binary Deserialization") may only start them - so that encoded data is never decoded as another type.
+ *
+ * Results are cached. The cache is flushed when further operations or static casts are registered - or when the cost profile changes.
+ */
+class tConversionPathPlanner : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Estimates cost of conversion option
+   *
+   * \param option Conversion option
+   * \return Estimated cost (in nanoseconds - rough values for typical hardware)
+   */
+  static double EstimateCost(const tConversionOption& option);
+
+  /*!
+   * Finds cheapest sequence of conversion operations for converting source to destination type.
+   *
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \return Cheapest sequence (all operations and intermediate types are set; empty if types are equal)
+   * \throw Throws std::runtime_error if there is no path between the types
+   */
+  static tConversionOperationSequence FindCheapestSequence(const tType& source_type, const tType& destination_type);
+
+  /*!
+   * Finds cheapest sequence of conversion operations for converting source to destination type that contains the specified operations in the specified order.
+   * Apart from these, sequence only contains implicit static casts (as inserted by tConversionOperationSequence::Compile()).
+   * tConversionOperationSequence::Compile() uses this if it cannot infer intermediate types.
+   * Results are not cached (compiled operations typically are).
+   *
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \param required_operations Operations that sequence must contain (in this order)
+   * eturn Cheapest sequence (all operations and intermediate types are set)
+   * 	hrow Throws std::runtime_error if there is no such sequence
+   */
+  static tConversionOperationSequence FindCheapestSequence(const tType& source_type, const tType& destination_type, const std::vector<const tRegisteredConversionOperation*>& required_operations);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Edge in conversion graph */
+  struct tEdge
+  {
+    /*! Registered operation */
+    const tRegisteredConversionOperation* operation;
+
+    /*! Type after operation */
+    tType destination_type;
+
+    /*! Cost in nanoseconds (measured or estimated) */
+    double cost;
+  };
+
+  /*! Cached search result */
+  struct tPath
+  {
+    /*! Operations in path */
+    std::vector<tEdge> edges;
+
+    /*! Whether path was found */
+    bool found;
+  };
+
+  /*! Static cast in conversion graph (costs are obtained during search - as they may change) */
+  struct tStaticCastEdge
+  {
+    const tRegisteredConversionOperation* operation;
+    const tConversionOption* option;
+  };
+
+  /*! Static cast edges by source type handle */
+  std::vector<std::vector<tStaticCastEdge>> static_cast_edges;
+
+  /*! Registered operations by source type handle (operations with a single supported source type) */
+  std::vector<std::vector<const tRegisteredConversionOperation*>> operations_by_source_type;
+
+  /*! Registered operations that support multiple source types */
+  std::vector<const tRegisteredConversionOperation*> generic_operations;
+
+  /*! Cached paths (key contains source and destination type handles) */
+  std::unordered_map<uint32_t, tPath> paths;
+
+  /*! Revision of registered operations that graph and paths were created with */
+  unsigned int revision;
+
+  /*! Revision of cost profile that paths were created with */
+  unsigned int profile_revision;
+
+  /*! Whether graph has been created */
+  bool graph_valid;
+
+  /*! Factor that estimated costs are multiplied with (fitted to cost profile - see FitEstimateScale()) */
+  double estimate_scale;
+
+  /*! Mutex for planner access */
+  rrlib::thread::tMutex mutex;
+
+
+  tConversionPathPlanner();
+
+  /*!
+   * \return Factor for scaling estimated costs to the measured costs in tConversionCostProfile (1 if profile is empty)
+   */
+  static double FitEstimateScale();
+
+  /*!
+   * \return Cost of operation for conversion option (measured or scaled estimate)
+   */
+  double GetCost(const tRegisteredConversionOperation& operation, const tConversionOption& option) const;
+
+  /*!
+   * Appends all edges leaving the specified type to the provided vector
+   *
+   * \param type Source type of edges
+   * \param destination_type Destination type of search
+   * \param depth Number of operations in path to 'type'
+   * \param edges Vector to append edges to
+   */
+  void GetEdges(const tType& type, const tType& destination_type, unsigned int depth, std::vector<tEdge>& edges) const;
+
+  /*!
+   * Appends all edges leaving the specified type to the provided vector - for searches with required operations
+   * (implicit static casts and the next required operation)
+   *
+   * \param type Source type of edges
+   * \param destination_type Destination type of search
+   * \param required_operation Next required operation (nullptr if all required operations are in path)
+   * \param edges Vector to append edges to
+   */
+  void GetEdges(const tType& type, const tType& destination_type, const tRegisteredConversionOperation* required_operation, std::vector<tEdge>& edges) const;
+
+  /*!
+   * \return Single instance of planner
+   */
+  static tConversionPathPlanner& Instance();
+
+  /*!
+   * Converts path to conversion sequence
+   */
+  static tConversionOperationSequence ToSequence(const tPath& path, const tType& source_type, const tType& destination_type);
+
+  /*!
+   * Creates graph from registered operations and static casts
+   */
+  void UpdateGraph();
+
+  /*!
+   * Updates graph and flushes cached paths if registered operations or cost profile changed (mutex must be locked)
+   */
+  void UpdateIfOutdated();
+
+  /*!
+   * Runs shortest path search
+   *
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \param required_operations Operations that path must contain in this order - with nothing but implicit static casts in between (nullptr for unconstrained search)
+   * \return Cheapest path
+   */
+  tPath Search(const tType& source_type, const tType& destination_type, const std::vector<const tRegisteredConversionOperation*>* required_operations = nullptr) const;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
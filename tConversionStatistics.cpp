@@ -0,0 +1,285 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionStatistics.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionStatistics.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <atomic>
+#include <memory>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Counters are allocated in blocks for this number of operation handles */
+const size_t cBLOCK_SIZE = 64;
+
+/*! Number of blocks required for all possible handles */
+const size_t cBLOCK_COUNT = (std::numeric_limits<uint16_t>::max() + 1) / cBLOCK_SIZE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Counters of one operation in one thread (only written by this thread) */
+struct tCounters
+{
+  std::atomic<uint64_t> calls, bytes_produced, latency_histogram[tConversionStatistics::cHISTOGRAM_BUCKETS];
+};
+
+/*! Counters of one thread */
+struct tThreadCounters
+{
+  /*! Blocks of counters (allocated when an operation of the block is called for the first time) */
+  std::atomic<tCounters*> blocks[cBLOCK_COUNT];
+
+  tThreadCounters()
+  {
+    for (auto & block : blocks)
+    {
+      block.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~tThreadCounters()
+  {
+    for (auto & block : blocks)
+    {
+      delete[] block.load();
+    }
+  }
+
+  /*!
+   * Adds values of other counters to these counters and resets other counters to zero
+   * (these counters may not be written by any thread concurrently)
+   */
+  void MoveFrom(tThreadCounters& other);
+};
+
+/*! Counters of all threads */
+struct tAllThreadCounters
+{
+  /*! Counters of running threads */
+  std::vector<std::unique_ptr<tThreadCounters>> threads;
+
+  /*! Accumulated counters of terminated threads */
+  tThreadCounters terminated_threads;
+
+  /*! Counters of terminated threads - zeroed and ready to be reused by new threads (keeps number of counter objects bounded by the number of concurrently running threads) */
+  std::vector<std::unique_ptr<tThreadCounters>> unused;
+
+  rrlib::thread::tMutex mutex;
+};
+
+tAllThreadCounters& AllThreadCounters()
+{
+  static tAllThreadCounters all_thread_counters;
+  return all_thread_counters;
+}
+
+/*! Counters of this thread - folded into counters of terminated threads when thread terminates */
+struct tThisThreadCounters
+{
+  tThreadCounters* counters = nullptr;
+
+  ~tThisThreadCounters()
+  {
+    if (counters)
+    {
+      tAllThreadCounters& all_thread_counters = AllThreadCounters();
+      rrlib::thread::tLock lock(all_thread_counters.mutex);
+      all_thread_counters.terminated_threads.MoveFrom(*counters);
+      for (auto it = all_thread_counters.threads.begin(); it != all_thread_counters.threads.end(); ++it)
+      {
+        if (it->get() == counters)
+        {
+          all_thread_counters.unused.push_back(std::move(*it));
+          all_thread_counters.threads.erase(it);
+          break;
+        }
+      }
+    }
+  }
+};
+
+thread_local tThisThreadCounters this_thread_counters;
+
+/*! Increments counter that only the calling thread writes to */
+inline void Add(std::atomic<uint64_t>& counter, uint64_t value)
+{
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/*! Adds value of other counter to counter and resets other counter to zero */
+inline void Move(std::atomic<uint64_t>& counter, std::atomic<uint64_t>& other)
+{
+  Add(counter, other.load(std::memory_order_relaxed));
+  other.store(0, std::memory_order_relaxed);
+}
+
+void tThreadCounters::MoveFrom(tThreadCounters& other)
+{
+  for (size_t i = 0; i < cBLOCK_COUNT; i++)
+  {
+    tCounters* other_block = other.blocks[i].load(std::memory_order_relaxed);
+    if (other_block)
+    {
+      tCounters* block = blocks[i].load(std::memory_order_relaxed);
+      if (!block)
+      {
+        block = new tCounters[cBLOCK_SIZE]();
+        blocks[i].store(block, std::memory_order_release);
+      }
+      for (size_t j = 0; j < cBLOCK_SIZE; j++)
+      {
+        Move(block[j].calls, other_block[j].calls);
+        Move(block[j].bytes_produced, other_block[j].bytes_produced);
+        for (size_t k = 0; k < tConversionStatistics::cHISTOGRAM_BUCKETS; k++)
+        {
+          Move(block[j].latency_histogram[k], other_block[j].latency_histogram[k]);
+        }
+      }
+    }
+  }
+}
+
+}
+
+std::vector<tConversionStatistics::tOperationStatistics> tConversionStatistics::GetSnapshot()
+{
+  std::vector<tOperationStatistics> result;
+  tAllThreadCounters& all_thread_counters = AllThreadCounters();
+  rrlib::thread::tLock lock(all_thread_counters.mutex);
+  for (const tRegisteredConversionOperation * operation : tRegisteredConversionOperation::GetRegisteredOperations().operation_list.GetSnapshot())
+  {
+    tOperationStatistics statistics = { operation, 0, 0, {} };
+    size_t handle = operation->GetHandle();
+    for (size_t t = 0; t <= all_thread_counters.threads.size(); t++)
+    {
+      const tThreadCounters* thread = t < all_thread_counters.threads.size() ? all_thread_counters.threads[t].get() : &all_thread_counters.terminated_threads;
+      const tCounters* block = thread->blocks[handle / cBLOCK_SIZE].load(std::memory_order_acquire);
+      if (block)
+      {
+        const tCounters& counters = block[handle % cBLOCK_SIZE];
+        statistics.calls += counters.calls.load(std::memory_order_relaxed);
+        statistics.bytes_produced += counters.bytes_produced.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < cHISTOGRAM_BUCKETS; i++)
+        {
+          statistics.latency_histogram[i] += counters.latency_histogram[i].load(std::memory_order_relaxed);
+        }
+      }
+    }
+    if (statistics.calls)
+    {
+      result.push_back(statistics);
+    }
+  }
+  return result;
+}
+
+void tConversionStatistics::Record(const tRegisteredConversionOperation* operation, size_t bytes_produced, int64_t nanoseconds)
+{
+  tThreadCounters* thread_counters = this_thread_counters.counters;
+  if (!thread_counters)
+  {
+    tAllThreadCounters& all_thread_counters = AllThreadCounters();
+    rrlib::thread::tLock lock(all_thread_counters.mutex);
+    if (all_thread_counters.unused.empty())
+    {
+      all_thread_counters.threads.emplace_back(new tThreadCounters());
+    }
+    else
+    {
+      all_thread_counters.threads.push_back(std::move(all_thread_counters.unused.back()));
+      all_thread_counters.unused.pop_back();
+    }
+    thread_counters = all_thread_counters.threads.back().get();
+    this_thread_counters.counters = thread_counters;
+  }
+
+  size_t handle = operation ? operation->GetHandle() : tStaticCastOperation::GetInstance().GetHandle();
+  std::atomic<tCounters*>& block_pointer = thread_counters->blocks[handle / cBLOCK_SIZE];
+  tCounters* block = block_pointer.load(std::memory_order_relaxed);
+  if (!block)
+  {
+    block = new tCounters[cBLOCK_SIZE]();
+    block_pointer.store(block, std::memory_order_release);
+  }
+
+  tCounters& counters = block[handle % cBLOCK_SIZE];
+  Add(counters.calls, 1);
+  Add(counters.bytes_produced, bytes_produced);
+  size_t bucket = 0;
+  for (uint64_t remaining = nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0; remaining && bucket < cHISTOGRAM_BUCKETS - 1; remaining >>= 1)
+  {
+    bucket++;
+  }
+  Add(counters.latency_histogram[bucket], 1);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,185 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tConversionStatistics.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConversionStatistics
+ *
+ * \b tConversionStatistics
+ *
+ * Optional runtime counters of conversion operations (call counts, bytes produced, latency histograms).
+ * Instrumentation is only compiled in if RRLIB_RTTI_CONVERSION_INSTRUMENTATION is defined to 1 -
+ * otherwise, conversion operations contain no instrumentation code at all.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tConversionStatistics_h__
+#define __rrlib__rtti_conversion__tConversionStatistics_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tRegisteredConversionOperation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Whether conversion operations are instrumented (must be the same in all translation units) */
+#ifndef RRLIB_RTTI_CONVERSION_INSTRUMENTATION
+#define RRLIB_RTTI_CONVERSION_INSTRUMENTATION 0
+#endif
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Runtime statistics of conversion operations
+/*!
+ * Counters are kept per registered conversion operation (indexed by its handle) and per thread.
+ * Each thread only writes its own counters (relaxed atomic stores, no locks) - GetSnapshot() sums up the counters of all threads.
+ * Counters of terminated threads are accumulated when threads terminate (and their counter objects are reused by new threads).
+ *
+ * Measurements are taken in tCompiledConversionOperation::Convert() (counted for the first operation of the compiled sequence)
+ * and tCurrentConversionOperation::Continue() (counted for the continued operation).
+ * Each operation's latency only includes its own step (time of continued operations is excluded).
+ * Operations without registered operation (implicit casts) are counted for the static cast operation.
+ */
+class tConversionStatistics
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  enum
+  {
+    /*!
+     * Number of buckets in latency histograms.
+     * Bucket 0 counts calls with latencies below 1 ns; bucket i > 0 counts latencies in [2^(i-1), 2^i) ns (last bucket: all larger latencies).
+     */
+    cHISTOGRAM_BUCKETS = 32
+  };
+
+  /*! Statistics of one registered conversion operation */
+  struct tOperationStatistics
+  {
+    /*! Registered conversion operation */
+    const tRegisteredConversionOperation* operation;
+
+    /*! Number of calls */
+    uint64_t calls;
+
+    /*! Bytes produced (sum of the sizes of all destination objects - dynamically allocated memory is not included) */
+    uint64_t bytes_produced;
+
+    /*! Latency histogram (see cHISTOGRAM_BUCKETS) */
+    uint64_t latency_histogram[cHISTOGRAM_BUCKETS];
+  };
+
+  /*!
+   * Measures one call (from construction to destruction).
+   * Time of measurements nested in this one (subsequent steps of the conversion) is not included in this call's latency.
+   */
+  class tMeasurement
+  {
+  public:
+    tMeasurement(const tRegisteredConversionOperation* operation, size_t bytes_produced) :
+      operation(operation),
+      bytes_produced(bytes_produced),
+      nested_nanoseconds(0),
+      parent(CurrentMeasurement()),
+      start(std::chrono::steady_clock::now())
+    {
+      CurrentMeasurement() = this;
+    }
+
+    ~tMeasurement()
+    {
+      int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      CurrentMeasurement() = parent;
+      if (parent)
+      {
+        parent->nested_nanoseconds += nanoseconds;
+      }
+      Record(operation, bytes_produced, nanoseconds - nested_nanoseconds);
+    }
+
+  private:
+    const tRegisteredConversionOperation* operation;
+    size_t bytes_produced;
+    int64_t nested_nanoseconds;
+    tMeasurement* parent;
+    std::chrono::steady_clock::time_point start;
+
+    /*! \return Innermost measurement currently running in this thread */
+    static tMeasurement*& CurrentMeasurement()
+    {
+      static thread_local tMeasurement* current = nullptr;
+      return current;
+    }
+  };
+
+  /*!
+   * \return Statistics of all operations that have been called at least once
+   */
+  static std::vector<tOperationStatistics> GetSnapshot();
+
+  /*!
+   * Records call of conversion operation (called by tMeasurement)
+   *
+   * \param operation Registered conversion operation (nullptr for implicit casts)
+   * \param bytes_produced Size of destination object
+   * \param nanoseconds Latency
+   */
+  static void Record(const tRegisteredConversionOperation* operation, size_t bytes_produced, int64_t nanoseconds);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -88,6 +88,19 @@ struct tCurrentConversionOperation
    */
   inline void Continue(const tTypedConstPointer& intermediate_object, const tTypedPointer& destination_object) const;
 
+  /*!
+   * Continue conversion operation with multiple results of the current one (e.g. all elements of a std::vector).
+   * Dispatching is done once for all objects: bitwise-copyable results are copied with memcpy, batch conversion functions are used if available.
+   * (note: implemented in tCompiledConversionOperation.h to handle cyclic dependency)
+   *
+   * \param first_intermediate_object Typed pointer to first intermediate object. Must have intermediate or destination type of conversion sequence.
+   * \param intermediate_stride Offset between two intermediate objects in bytes
+   * \param first_destination_object Typed pointer to first destination object. Its type must be equal to destination_type.
+   * \param destination_stride Offset between two destination objects in bytes
+   * \param count Number of objects
+   */
+  inline void ContinueBatch(const tTypedConstPointer& first_intermediate_object, size_t intermediate_stride, const tTypedPointer& first_destination_object, size_t destination_stride, size_t count) const;
+
   /*!
    * Get conversion parameter
    * (note: implemented in tCompiledConversionOperation.h to handle cyclic dependency)
@@ -95,6 +108,14 @@ struct tCurrentConversionOperation
    * \return Pointer to buffer with parameter if it has been specified (otherwise nullptr -> the conversion operation should use a default value)
    */
   inline tTypedConstPointer GetParameterValue() const;
+
+  /*!
+   * Get state word that registered operation decoded from its parameter in tRegisteredConversionOperation::SpecializeForParameter()
+   * (note: implemented in tCompiledConversionOperation.h to handle cyclic dependency)
+   *
+   * \return Parameter state (zero if operation does not specialize for parameters)
+   */
+  inline uint64_t GetParameterState() const;
 };
 
 //----------------------------------------------------------------------
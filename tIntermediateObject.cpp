@@ -0,0 +1,187 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tIntermediateObject.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tIntermediateObject.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Slot in arena */
+struct tSlot
+{
+  /*! Object of slot's type (created when slot is used for the first time) */
+  std::unique_ptr<tGenericObject> object;
+
+  /*! Whether object is currently used by a conversion */
+  bool in_use = false;
+};
+
+/*! Per-thread arena (index is type handle; slots are allocated separately so that their addresses remain valid when vector grows) */
+thread_local std::vector<std::unique_ptr<tSlot>> arena;
+
+/*!
+ * \return Heap memory retained by object (approximation: std::string capacity and list elements - 0 for other types)
+ */
+size_t RetainedBytes(const tGenericObject& object)
+{
+  const tType& type = object.GetType();
+  if (type == tDataType<std::string>())
+  {
+    return object.Get<std::string>()->capacity();
+  }
+  if (type.IsListType())
+  {
+    return object.GetVectorSize() * type.GetElementType().GetSize();
+  }
+  return 0;
+}
+
+}
+
+tIntermediateObject::tIntermediateObject(const tType& type, serialization::tInputStream& stream) :
+  object(nullptr),
+  slot_in_use(nullptr)
+{
+  AcquireAndDeserialize(type, stream);
+}
+
+tIntermediateObject::tIntermediateObject(const tType& type, serialization::tStringInputStream& stream) :
+  object(nullptr),
+  slot_in_use(nullptr)
+{
+  AcquireAndDeserialize(type, stream);
+}
+
+tIntermediateObject::~tIntermediateObject()
+{
+  Release();
+}
+
+template <typename TStream>
+void tIntermediateObject::AcquireAndDeserialize(const tType& type, TStream& stream)
+{
+  size_t handle = type.GetHandle();
+  if (arena.size() <= handle)
+  {
+    arena.resize(handle + 1);
+  }
+  if (!arena[handle])
+  {
+    arena[handle].reset(new tSlot());
+  }
+
+  tSlot& slot = *arena[handle];
+  if (!slot.in_use)
+  {
+    if (!slot.object)
+    {
+      slot.object.reset(type.CreateGenericObject());
+    }
+    slot.in_use = true;
+    slot_in_use = &slot.in_use;
+    object = slot.object.get();
+  }
+  else
+  {
+    temporary_object.reset(type.CreateGenericObject());
+    object = temporary_object.get();
+  }
+  assert(object->GetType() == type);
+
+  try
+  {
+    object->Deserialize(stream);
+  }
+  catch (...)
+  {
+    Release();  // destructor is not called if constructor throws
+    throw;
+  }
+}
+
+void tIntermediateObject::Release()
+{
+  if (slot_in_use)
+  {
+    *slot_in_use = false;
+    slot_in_use = nullptr;
+    if (RetainedBytes(*object) > cMAX_RETAINED_BYTES)
+    {
+      arena[object->GetType().GetHandle()]->object.reset();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,150 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tIntermediateObject.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tIntermediateObject
+ *
+ * \b tIntermediateObject
+ *
+ * Deserialized intermediate object of a two-step conversion whose type is only known at runtime.
+ * Objects are taken from a per-thread arena with one object per type - and are reused by subsequent deserializations.
+ * This way, heap-owning intermediates (e.g. std::vector or std::string) keep their capacity across calls
+ * and steady-state deserializations do not allocate memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tIntermediateObject_h__
+#define __rrlib__rtti_conversion__tIntermediateObject_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/rtti/rtti.h"
+#include "rrlib/serialization/serialization.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <memory>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Reusable deserialized intermediate object
+/*!
+ * Deserialized intermediate object of a two-step conversion whose type is only known at runtime.
+ *
+ * The object is acquired from the calling thread's arena on construction and released on destruction.
+ * If the thread's object of this type is already in use (nested conversions), a temporary object is created instead.
+ *
+ * Contract: Acquired objects still contain the value of their previous use. Objects are therefore only handed out
+ * after they have been deserialized from a stream - which overwrites the complete object.
+ * There is intentionally no way to obtain an object without deserializing it.
+ *
+ * Objects that retain more than cMAX_RETAINED_BYTES of heap memory (std::string capacity or list elements)
+ * are not kept in the arena - so that a single large conversion does not occupy memory for the thread's lifetime.
+ */
+class tIntermediateObject : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum heap memory (in bytes) of an object that is kept in arena after use */
+  enum { cMAX_RETAINED_BYTES = 64 * 1024 };
+
+  /*!
+   * \param type Type of intermediate object
+   * \param stream Stream to deserialize object from
+   */
+  tIntermediateObject(const tType& type, serialization::tInputStream& stream);
+  tIntermediateObject(const tType& type, serialization::tStringInputStream& stream);
+
+  ~tIntermediateObject();
+
+  tGenericObject& operator*() const
+  {
+    return *object;
+  }
+
+  tGenericObject* operator->() const
+  {
+    return object;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Intermediate object */
+  tGenericObject* object;
+
+  /*! In-use flag of arena slot that object was acquired from (nullptr if object is temporary) */
+  bool* slot_in_use;
+
+  /*! Owns object if it is temporary */
+  std::unique_ptr<tGenericObject> temporary_object;
+
+
+  /*!
+   * Acquires object from arena (or creates temporary object) and deserializes it from stream
+   */
+  template <typename TStream>
+  void AcquireAndDeserialize(const tType& type, TStream& stream);
+
+  /*!
+   * Releases object to arena (discards it if it retains too much memory)
+   */
+  void Release();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
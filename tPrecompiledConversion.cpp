@@ -0,0 +1,130 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tPrecompiledConversion.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tPrecompiledConversion.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tPrecompiledConversion::tPrecompiledConversion(const tType& source_type, const tType& destination_type, std::initializer_list<const char*> operation_names, std::initializer_list<tType> intermediate_types,
+    tConversionOption::tConversionFunction conversion_function, tConversionOption::tBatchConversionFunction batch_conversion_function) :
+  source_type(source_type),
+  destination_type(destination_type),
+  operation_names(operation_names),
+  intermediate_types(intermediate_types),
+  conversion_function(conversion_function),
+  batch_conversion_function(batch_conversion_function)
+{
+  assert(conversion_function && this->operation_names.size() <= tConversionOperationSequence::cMAX_SIZE);
+  RegisteredConversions().Add(HashTypes(source_type, destination_type), this);
+  tRegisteredConversionOperation::RegisteredOperations().revision++;
+}
+
+const tPrecompiledConversion* tPrecompiledConversion::Find(const tConversionOperationSequence& sequence, const tType& source_type, const tType& destination_type)
+{
+  for (auto entry = RegisteredConversions().Find(HashTypes(source_type, destination_type)); entry; entry = entry->NextWithSameHash())
+  {
+    if (entry->value->Matches(sequence))  // hash values are unique for each pair of types
+    {
+      return entry->value;
+    }
+  }
+  return nullptr;
+}
+
+bool tPrecompiledConversion::Matches(const tConversionOperationSequence& sequence) const
+{
+  size_t size = sequence.Size();
+  if (size != operation_names.size())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < size; i++)
+  {
+    if (strcmp(sequence[i].first, operation_names[i]) != 0 || sequence.GetParameterValue(i))
+    {
+      return false;
+    }
+    if (i + 1 < size && sequence.IntermediateType(i) != (i < intermediate_types.size() ? intermediate_types[i] : tType()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+tRegisterIndex<const tPrecompiledConversion*>& tPrecompiledConversion::RegisteredConversions()
+{
+  static tRegisterIndex<const tPrecompiledConversion*> conversions;
+  return conversions;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,168 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tPrecompiledConversion.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tPrecompiledConversion
+ *
+ * \b tPrecompiledConversion
+ *
+ * Conversion function generated ahead of time for a specific conversion sequence and specific types
+ * (typically by tConversionCodeGenerator).
+ * tConversionOperationSequence::Compile() uses it instead of the registered operations
+ * if sequence, source and destination type match exactly.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tPrecompiledConversion_h__
+#define __rrlib__rtti_conversion__tPrecompiledConversion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <initializer_list>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tConversionOperationSequence.h"
+#include "rrlib/rtti_conversion/tConversionOption.h"
+#include "rrlib/rtti_conversion/tRegisterIndex.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Precompiled conversion
+/*!
+ * Conversion function generated ahead of time for a specific conversion sequence and specific types
+ * (typically by tConversionCodeGenerator).
+ * tConversionOperationSequence::Compile() uses it instead of the registered operations
+ * if sequence, source and destination type match exactly.
+ *
+ * Precompiled conversions register themselves on construction. They must exist until the program shuts down
+ * (typically, they are global constants in generated translation units).
+ * As they may be constructed before the registered operations they refer to, operations are specified by name.
+ * Registering a precompiled conversion increments the revision of the registered operations - so that caches
+ * (e.g. tCompiledConversionOperationCache) no longer return conversions compiled without it.
+ */
+class tPrecompiledConversion : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \param operation_names Names of operations in sequence (string literals)
+   * \param intermediate_types Intermediate types as specified in sequence (possibly empty types)
+   * \param conversion_function Conversion function (must not call tCurrentConversionOperation::Continue())
+   * \param batch_conversion_function Function for converting multiple objects at once (optional)
+   */
+  tPrecompiledConversion(const tType& source_type, const tType& destination_type, std::initializer_list<const char*> operation_names, std::initializer_list<tType> intermediate_types,
+                         tConversionOption::tConversionFunction conversion_function, tConversionOption::tBatchConversionFunction batch_conversion_function = nullptr);
+
+  /*!
+   * Finds precompiled conversion for sequence and types
+   *
+   * \param sequence Conversion sequence (must not have any parameters)
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \return Precompiled conversion that matches exactly (nullptr if there is none)
+   */
+  static const tPrecompiledConversion* Find(const tConversionOperationSequence& sequence, const tType& source_type, const tType& destination_type);
+
+  /*!
+   * \return Conversion option with the precompiled functions (standard conversion function)
+   */
+  tConversionOption GetConversionOption() const
+  {
+    return tConversionOption(source_type, destination_type, false, conversion_function, conversion_function, batch_conversion_function);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Source and destination types */
+  tType source_type, destination_type;
+
+  /*! Names of operations in sequence */
+  std::vector<const char*> operation_names;
+
+  /*! Intermediate types as specified in sequence */
+  std::vector<tType> intermediate_types;
+
+  /*! Precompiled functions */
+  tConversionOption::tConversionFunction conversion_function;
+  tConversionOption::tBatchConversionFunction batch_conversion_function;
+
+
+  /*!
+   * \return Hash value for pair of source and destination type (unique for every type pair)
+   */
+  static size_t HashTypes(const tType& source_type, const tType& destination_type)
+  {
+    return (static_cast<size_t>(source_type.GetHandle()) << 16) | destination_type.GetHandle();
+  }
+
+  /*!
+   * \return Whether this precompiled conversion matches sequence exactly
+   */
+  bool Matches(const tConversionOperationSequence& sequence) const;
+
+  /*!
+   * \return Index with all precompiled conversions (hash values are computed with HashTypes())
+   */
+  static tRegisterIndex<const tPrecompiledConversion*>& RegisteredConversions();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
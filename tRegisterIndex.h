@@ -0,0 +1,198 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tRegisterIndex.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tRegisterIndex
+ *
+ * \b tRegisterIndex
+ *
+ * Hash index over entries of a register (e.g. the registered conversion operations).
+ * Entries can only be added - and are never removed before the index is destructed.
+ * Therefore, lookups are wait-free and do not allocate memory. Adding entries is lock-free.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tRegisterIndex_h__
+#define __rrlib__rtti_conversion__tRegisterIndex_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Hash index over register entries
+/*!
+ * Hash index over entries of a register (e.g. the registered conversion operations).
+ * The index only stores hash values - so callers need to check whether entries with matching hash actually match the key they are looking for.
+ *
+ * Entries can only be added - and are never removed before the index is destructed.
+ * Adding entries is lock-free (entries are appended with compare-and-swap). Lookups are wait-free and do not allocate memory.
+ * Entries with equal hash are returned in the order they were added.
+ *
+ * \tparam TValue Type of indexed values (should be cheap to copy - e.g. a pointer)
+ * \tparam Tbucket_count Number of hash buckets (should be a power of two)
+ */
+template <typename TValue, size_t Tbucket_count = 256>
+class tRegisterIndex : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Entry in index */
+  class tEntry : public rrlib::util::tNoncopyable
+  {
+  public:
+
+    /*! Hash value of entry */
+    const size_t hash;
+
+    /*! Indexed value */
+    const TValue value;
+
+    /*!
+     * \return Next entry with the same hash value (nullptr if there is no such entry)
+     */
+    const tEntry* NextWithSameHash() const
+    {
+      const tEntry* entry = next.load(std::memory_order_acquire);
+      while (entry && entry->hash != hash)
+      {
+        entry = entry->next.load(std::memory_order_acquire);
+      }
+      return entry;
+    }
+
+  private:
+
+    friend class tRegisterIndex;
+
+    /*! Next entry in bucket */
+    std::atomic<tEntry*> next;
+
+    tEntry(size_t hash, const TValue& value) : hash(hash), value(value), next(nullptr)
+    {}
+  };
+
+  tRegisterIndex()
+  {
+    for (auto & bucket : buckets)
+    {
+      bucket.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~tRegisterIndex()
+  {
+    for (auto & bucket : buckets)
+    {
+      tEntry* entry = bucket.load(std::memory_order_relaxed);
+      while (entry)
+      {
+        tEntry* next = entry->next.load(std::memory_order_relaxed);
+        delete entry;
+        entry = next;
+      }
+    }
+  }
+
+  /*!
+   * Adds entry to index
+   *
+   * \param hash Hash value of entry
+   * \param value Value to add
+   */
+  void Add(size_t hash, const TValue& value)
+  {
+    tEntry* entry = new tEntry(hash, value);
+    std::atomic<tEntry*>* tail = &buckets[hash % Tbucket_count];
+    tEntry* expected = nullptr;
+    while (!tail->compare_exchange_weak(expected, entry, std::memory_order_release, std::memory_order_acquire))
+    {
+      if (expected)
+      {
+        tail = &expected->next;
+        expected = nullptr;
+      }
+    }
+  }
+
+  /*!
+   * \param hash Hash value to look for
+   * \return First entry with specified hash value (nullptr if there is no such entry). Further entries can be obtained via tEntry::NextWithSameHash().
+   */
+  const tEntry* Find(size_t hash) const
+  {
+    const tEntry* entry = buckets[hash % Tbucket_count].load(std::memory_order_acquire);
+    while (entry && entry->hash != hash)
+    {
+      entry = entry->next.load(std::memory_order_acquire);
+    }
+    return entry;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Hash buckets (each contains a singly-linked list of entries) */
+  std::atomic<tEntry*> buckets[Tbucket_count];
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
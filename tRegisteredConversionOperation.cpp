@@ -33,6 +33,8 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/thread/tLock.h"
+#include <cstring>
+#include <initializer_list>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -84,7 +86,7 @@ tRegisteredConversionOperation::tRegisteredConversionOperation(util::tManagedCon
   {
     throw std::runtime_error(std::string("Conversion operation: '") + this->name.Get() + "'. Parameters have to be string serializable.");
   }
-  handle = static_cast<decltype(handle)>(tRegisteredConversionOperation::RegisteredOperations().operations.Add(this));
+  AddToRegister();
 }
 
 tRegisteredConversionOperation::tRegisteredConversionOperation() :
@@ -95,7 +97,7 @@ tRegisteredConversionOperation::tRegisteredConversionOperation() :
   single_conversion_option(nullptr),
   handle(-1)
 {
-  handle = static_cast<decltype(handle)>(tRegisteredConversionOperation::RegisteredOperations().operations.Add(this));
+  AddToRegister();
 }
 
 tRegisteredConversionOperation::~tRegisteredConversionOperation()
@@ -133,9 +135,10 @@ const tRegisteredConversionOperation* tRegisteredConversionOperation::Deserializ
       return &tStaticCastOperation::GetInstance();
     }
 
-    tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
-    for (auto & operation : registered_operations.operations)
+    const tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+    for (auto entry = registered_operations.content_index.Find(HashContent(name.c_str(), source_types, destination_types)); entry; entry = entry->NextWithSameHash())
     {
+      const tRegisteredConversionOperation* operation = entry->value;
       if (operation->supported_source_types.filter == source_types.filter && operation->supported_source_types.single_type == source_types.single_type && operation->supported_destination_types.filter == destination_types.filter && operation->supported_destination_types.single_type == destination_types.single_type && name == operation->Name())
       {
         return operation;
@@ -149,19 +152,20 @@ const tRegisteredConversionOperation* tRegisteredConversionOperation::Deserializ
   return result;
 }
 
-std::pair<const tRegisteredConversionOperation*, bool> tRegisteredConversionOperation::Find(const std::string& name)
+std::pair<const tRegisteredConversionOperation*, bool> tRegisteredConversionOperation::Find(const char* name)
 {
   std::pair<const tRegisteredConversionOperation*, bool> result(nullptr, false);
-  if (name == cSTATIC_CAST_NAME)
+  if (strcmp(name, cSTATIC_CAST_NAME) == 0)
   {
     result.first = &tStaticCastOperation::GetInstance();
     return result;
   }
 
-  tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
-  for (auto & operation : registered_operations.operations)
+  const tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+  for (auto entry = registered_operations.name_index.Find(HashName(name)); entry; entry = entry->NextWithSameHash())
   {
-    if (name == operation->Name())
+    const tRegisteredConversionOperation* operation = entry->value;
+    if (strcmp(name, operation->Name()) == 0)
     {
       if (!result.first)
       {
@@ -177,25 +181,26 @@ std::pair<const tRegisteredConversionOperation*, bool> tRegisteredConversionOper
   return result;
 }
 
-const tRegisteredConversionOperation& tRegisteredConversionOperation::Find(const std::string& name, const tType& source_type, const tType& destination_type)
+const tRegisteredConversionOperation& tRegisteredConversionOperation::Find(const char* name, const tType& source_type, const tType& destination_type)
 {
   const tRegisteredConversionOperation* result = nullptr;
-  if (name == cSTATIC_CAST_NAME)
+  if (strcmp(name, cSTATIC_CAST_NAME) == 0)
   {
     return tStaticCastOperation::GetInstance();
   }
 
-  tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
-  for (auto & operation : registered_operations.operations)
+  const tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+  for (auto entry = registered_operations.name_index.Find(HashName(name)); entry; entry = entry->NextWithSameHash())
   {
-    if (name == operation->Name())
+    const tRegisteredConversionOperation* operation = entry->value;
+    if (strcmp(name, operation->Name()) == 0)
     {
       auto option = operation->GetConversionOption(source_type, destination_type);
       if (option.type != tConversionOptionType::NONE)
       {
         if (result)
         {
-          throw std::runtime_error("Lookup of registered conversion operation " + name + " is ambiguous");
+          throw std::runtime_error(std::string("Lookup of registered conversion operation ") + name + " is ambiguous");
         }
         result = operation;
       }
@@ -203,7 +208,7 @@ const tRegisteredConversionOperation& tRegisteredConversionOperation::Find(const
   }
   if (!result)
   {
-    throw std::runtime_error("Lookup of registered conversion operation " + name + " with specified types failed");
+    throw std::runtime_error(std::string("Lookup of registered conversion operation ") + name + " with specified types failed");
   }
 
   return *result;
@@ -226,6 +231,49 @@ tConversionOption tRegisteredConversionOperation::GetConversionOption(const tTyp
   return tConversionOption();
 }
 
+tRegisteredConversionOperation::tPathPlanningRole tRegisteredConversionOperation::PathPlanningRole() const
+{
+  return parameter ? tPathPlanningRole::EXCLUDED : tPathPlanningRole::CONVERSION;
+}
+
+tConversionOption tRegisteredConversionOperation::SpecializeForParameter(const tConversionOption& option, const tTypedConstPointer&, uint64_t&) const
+{
+  return option;
+}
+
+size_t tRegisteredConversionOperation::HashName(const char* name)
+{
+  // FNV-1a
+  size_t hash = 2166136261u;
+  for (; *name; name++)
+  {
+    hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+  }
+  return hash;
+}
+
+size_t tRegisteredConversionOperation::HashContent(const char* name, const tSupportedTypes& source_types, const tSupportedTypes& destination_types)
+{
+  size_t hash = HashName(name);
+  for (const tSupportedTypes* types : { &source_types, &destination_types })
+  {
+    uint16_t single_type = types->filter == tSupportedTypeFilter::SINGLE ? types->single_type.GetHandle() : 0;
+    hash = (hash ^ static_cast<size_t>(types->filter)) * 16777619u;
+    hash = (hash ^ single_type) * 16777619u;
+  }
+  return hash;
+}
+
+void tRegisteredConversionOperation::AddToRegister()
+{
+  tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+  handle = static_cast<decltype(handle)>(registered_operations.operations.Add(this));
+  registered_operations.operation_list.Add(this);
+  registered_operations.name_index.Add(HashName(Name()), this);
+  registered_operations.content_index.Add(HashContent(Name(), supported_source_types, supported_destination_types), this);
+  registered_operations.revision++;
+}
+
 tRegisteredConversionOperation::tRegisteredOperations& tRegisteredConversionOperation::RegisteredOperations()
 {
   static tRegisteredOperations operations;
@@ -52,6 +52,8 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/thread/tMutex.h"
+#include "rrlib/rtti_conversion/tRegisterIndex.h"
+#include "rrlib/rtti_conversion/tSnapshotList.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -151,6 +153,15 @@ public:
 //    }
   };
 
+  /*! Role of operation in conversion paths that are planned automatically (see tConversionPathPlanner) */
+  enum class tPathPlanningRole
+  {
+    CONVERSION, //!< Operation converts values (may be used at any position in planned paths)
+    ENCODING,   //!< Operation encodes values (e.g. serialization) - may only be the last operation in planned paths
+    DECODING,   //!< Operation decodes values (e.g. deserialization) - may only be the first operation in planned paths (so encoded data is never decoded as another type)
+    EXCLUDED    //!< Operation is not used in planned paths
+  };
+
   /*! Data structure for managing registered operations */
   struct tRegisteredOperations
   {
@@ -165,6 +176,25 @@ public:
     /*! Registered static cast operations */
     typedef rrlib::serialization::tRegister<const tConversionOptionStaticCast*, 64, 64, uint16_t> tStaticCastRegister;
     tStaticCastRegister static_casts;
+
+    /*!
+     * Registered operations and static casts for wait-free iteration (in order of registration - as in 'operations' and 'static_casts').
+     * Real-time threads can iterate over these while other threads register operations.
+     */
+    tSnapshotList<const tRegisteredConversionOperation*> operation_list;
+    tSnapshotList<const tConversionOptionStaticCast*> static_cast_list;
+
+    /*! Index of registered static casts by source and destination type (hash values are computed with tStaticCastOperation::HashTypes()) */
+    tRegisterIndex<const tConversionOptionStaticCast*> static_cast_index;
+
+    /*! Index of registered operations by name (hash values are computed with HashName()) */
+    tRegisterIndex<const tRegisteredConversionOperation*> name_index;
+
+    /*! Index of registered operations by name and supported types - as serialized (hash values are computed with HashContent()) */
+    tRegisterIndex<const tRegisteredConversionOperation*> content_index;
+
+    /*! Incremented whenever an operation, a static cast or a precompiled conversion is registered (allows detecting outdated data derived from the registers) */
+    std::atomic<unsigned int> revision { 0 };
   };
 
 
@@ -185,7 +215,11 @@ public:
    * \param name Name of conversion operation
    * \return Registered operation with the specified name. Second indicates whether there are more registered conversion operations with this name.
    */
-  static std::pair<const tRegisteredConversionOperation*, bool> Find(const std::string& name);
+  static std::pair<const tRegisteredConversionOperation*, bool> Find(const char* name);
+  static std::pair<const tRegisteredConversionOperation*, bool> Find(const std::string& name)
+  {
+    return Find(name.c_str());
+  }
 
   /*!
    * Find registered conversion operation with specified name that support specified source and destination types
@@ -196,7 +230,11 @@ public:
    * \return Registered operation with the specified name and types.
    * \throw Throws std::runtime_error if conversion was not found or is ambiguous.
    */
-  static const tRegisteredConversionOperation& Find(const std::string& name, const tType& source_type, const tType& destination_type);
+  static const tRegisteredConversionOperation& Find(const char* name, const tType& source_type, const tType& destination_type);
+  static const tRegisteredConversionOperation& Find(const std::string& name, const tType& source_type, const tType& destination_type)
+  {
+    return Find(name.c_str(), source_type, destination_type);
+  }
 
   /*!
    * Gets conversion option for converting the specified types.
@@ -208,6 +246,20 @@ public:
    */
   virtual tConversionOption GetConversionOption(const tType& source_type, const tType& destination_type) const;
 
+  /*!
+   * Specializes conversion option for a parameter value.
+   * Called whenever a conversion sequence containing this operation is compiled.
+   * Operations can pre-decode their parameter here - into different conversion functions and/or a state word
+   * (obtained via tCurrentConversionOperation::GetParameterState()) - so that conversion functions need not interpret the parameter on every call.
+   * The default implementation returns the option unchanged.
+   *
+   * \param option Conversion option as returned by GetConversionOption()
+   * \param parameter Parameter value (empty pointer if no parameter was specified)
+   * \param parameter_state State word stored in compiled conversion operation (zero initially)
+   * \return Conversion option to compile (must have the same type, source and destination type as 'option')
+   */
+  virtual tConversionOption SpecializeForParameter(const tConversionOption& option, const tTypedConstPointer& parameter, uint64_t& parameter_state) const;
+
   /*!
    * \return Local handle of operation
    */
@@ -240,6 +292,12 @@ public:
     return parameter;
   }
 
+  /*!
+   * \return Role of operation in conversion paths that are planned automatically.
+   * The default implementation excludes operations with parameter (as their result depends on it) and treats all others as conversions.
+   */
+  virtual tPathPlanningRole PathPlanningRole() const;
+
   /*!
    * \return Supported source types of cast operation
    */
@@ -283,6 +341,7 @@ protected:
 private:
 
   friend class tStaticCastOperation;
+  friend class tPrecompiledConversion;
 
   /*! Name of conversion operation (must be unique for every supported combination of source and destination types) */
   util::tManagedConstCharPointer name;
@@ -303,6 +362,25 @@ private:
   /*! constructor for tStaticCastOperation */
   tRegisteredConversionOperation();
 
+  /*!
+   * \param name Name of conversion operation
+   * \return Hash value of name (as used in name index)
+   */
+  static size_t HashName(const char* name);
+
+  /*!
+   * \param name Name of conversion operation
+   * \param source_types Supported source types
+   * \param destination_types Supported destination types
+   * \return Hash value of serialized data of operation (as used in content index)
+   */
+  static size_t HashContent(const char* name, const tSupportedTypes& source_types, const tSupportedTypes& destination_types);
+
+  /*!
+   * Adds this operation to register and indexes (called by constructors)
+   */
+  void AddToRegister();
+
   /*!
    * \return Registered type conversion operations.
    */
@@ -0,0 +1,184 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tScratchIntermediate.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tScratchIntermediate
+ *
+ * \b tScratchIntermediate
+ *
+ * Intermediate object for first conversion functions that write their result into an existing object
+ * before calling tCurrentConversionOperation::Continue().
+ * For types that own heap memory (e.g. std::vector<double>), a thread-local object is reused,
+ * so that its capacity is kept across conversions and steady-state conversions do not allocate memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tScratchIntermediate_h__
+#define __rrlib__rtti_conversion__tScratchIntermediate_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/serialization/serialization.h"
+#include <memory>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Scratch intermediate object
+/*!
+ * Intermediate object for first conversion functions that write their result into an existing object.
+ *
+ * If T is not trivially copyable, a thread-local object is acquired on construction and released on destruction.
+ * If this object is already in use (nested conversions), a temporary object is created instead.
+ * Note that the thread-local object contains the result of the previous conversion - so functions must overwrite it
+ * (as they must when writing to destination objects of final conversion functions).
+ *
+ * If T is trivially copyable, the object is simply a local variable.
+ *
+ * \tparam T Type of intermediate object
+ */
+template <typename T, bool Treuse = !std::is_trivially_copyable<T>::value>
+class tScratchIntermediate : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tScratchIntermediate() :
+    slot(GetSlot()),
+    object(nullptr)
+  {
+    if (slot.in_use)
+    {
+      temporary_object.reset(new T(serialization::DefaultInstantiation<T>::Create()));
+      object = temporary_object.get();
+    }
+    else
+    {
+      slot.in_use = true;
+      object = &slot.object;
+    }
+  }
+
+  ~tScratchIntermediate()
+  {
+    if (!temporary_object)
+    {
+      slot.in_use = false;
+    }
+  }
+
+  /*!
+   * \return Intermediate object
+   */
+  T& Get() const
+  {
+    return *object;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Thread-local object */
+  struct tSlot
+  {
+    T object;
+    bool in_use;
+
+    tSlot() : object(serialization::DefaultInstantiation<T>::Create()), in_use(false)
+    {}
+  };
+
+  /*! Thread-local slot */
+  tSlot& slot;
+
+  /*! Intermediate object */
+  T* object;
+
+  /*! Owns object if it is temporary */
+  std::unique_ptr<T> temporary_object;
+
+  static tSlot& GetSlot()
+  {
+    static thread_local tSlot slot;
+    return slot;
+  }
+};
+
+/*! Trivially copyable types: local variable */
+template <typename T>
+class tScratchIntermediate<T, false> : public rrlib::util::tNoncopyable
+{
+public:
+
+  tScratchIntermediate() :
+    object(serialization::DefaultInstantiation<T>::Create())
+  {}
+
+  T& Get() const
+  {
+    return object;
+  }
+
+private:
+
+  mutable T object;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
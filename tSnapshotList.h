@@ -0,0 +1,202 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tSnapshotList.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tSnapshotList
+ *
+ * \b tSnapshotList
+ *
+ * Append-only list whose readers iterate over immutable snapshots (RCU-style).
+ * Readers never block - not even while entries are being added.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tSnapshotList_h__
+#define __rrlib__rtti_conversion__tSnapshotList_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/thread/tLock.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Append-only list with snapshot reads
+/*!
+ * Append-only list whose readers obtain immutable snapshots.
+ * Obtaining and iterating over a snapshot is wait-free. Adding entries is serialized with a mutex.
+ *
+ * Each Add() publishes a new snapshot. Snapshots and entry buffers are never freed before the list is destructed,
+ * so readers may use them as long as they like. Buffers grow by doubling their capacity - memory overhead is therefore
+ * at most two times the size of the entries (plus a small snapshot object per entry).
+ *
+ * \tparam T Type of entries (should be cheap to copy - e.g. a pointer)
+ */
+template <typename T>
+class tSnapshotList : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Immutable snapshot of list */
+  class tSnapshot : public rrlib::util::tNoncopyable
+  {
+  public:
+
+    const T* begin() const
+    {
+      return entries;
+    }
+
+    const T* end() const
+    {
+      return entries + size;
+    }
+
+    const T& operator[](size_t index) const
+    {
+      return entries[index];
+    }
+
+    size_t Size() const
+    {
+      return size;
+    }
+
+  private:
+
+    friend class tSnapshotList;
+
+    /*! Entries in snapshot */
+    const T* const entries;
+
+    /*! Number of entries in snapshot */
+    const size_t size;
+
+    tSnapshot(const T* entries, size_t size) : entries(entries), size(size)
+    {}
+  };
+
+  tSnapshotList() :
+    capacity(0)
+  {
+    snapshots.emplace_back(new tSnapshot(nullptr, 0));
+    current_snapshot.store(snapshots.back().get(), std::memory_order_relaxed);
+  }
+
+  /*!
+   * Appends entry to list
+   *
+   * \param value Value to add
+   */
+  void Add(const T& value)
+  {
+    rrlib::thread::tLock lock(mutex);
+    size_t size = current_snapshot.load(std::memory_order_relaxed)->size;
+    if (size == capacity)
+    {
+      // Allocate new buffer (old one remains valid for readers of older snapshots)
+      size_t new_capacity = capacity ? capacity * 2 : 64;
+      std::unique_ptr<T[]> new_buffer(new T[new_capacity]);
+      for (size_t i = 0; i < size; i++)
+      {
+        new_buffer[i] = buffers.back()[i];
+      }
+      buffers.emplace_back(std::move(new_buffer));
+      capacity = new_capacity;
+    }
+
+    // Entries beyond the size of published snapshots are not accessed by readers
+    T* buffer = buffers.back().get();
+    buffer[size] = value;
+    snapshots.emplace_back(new tSnapshot(buffer, size + 1));
+    current_snapshot.store(snapshots.back().get(), std::memory_order_release);
+  }
+
+  /*!
+   * \return Current snapshot of list (contains all entries added before this call)
+   */
+  const tSnapshot& GetSnapshot() const
+  {
+    return *current_snapshot.load(std::memory_order_acquire);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Current snapshot */
+  std::atomic<const tSnapshot*> current_snapshot;
+
+  /*! All snapshots that were published (retained for readers) */
+  std::vector<std::unique_ptr<tSnapshot>> snapshots;
+
+  /*! All entry buffers (last one is current; older ones are retained for readers) */
+  std::vector<std::unique_ptr<T[]>> buffers;
+
+  /*! Capacity of current buffer */
+  size_t capacity;
+
+  /*! Mutex for adding entries */
+  rrlib::thread::tMutex mutex;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -32,6 +32,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
+#include <memory>
+#include <vector>
 #include "rrlib/thread/tLock.h"
 
 //----------------------------------------------------------------------
@@ -69,6 +72,57 @@ namespace conversion
 // Implementation
 //----------------------------------------------------------------------
 
+namespace
+{
+
+/*! Memorized results of GetImplicitConversionOptions() for one revision of registered operations */
+struct tImplicitConversionOptionsRevision
+{
+  /*! Revision of registered operations that results were computed with */
+  const unsigned int revision;
+
+  /*! Memorized results - one entry per pair of source and destination type (hash values are computed with tStaticCastOperation::HashTypes() - which is unique for each pair) */
+  tRegisterIndex<std::pair<tConversionOption, tConversionOption>, 1024> results;
+
+  explicit tImplicitConversionOptionsRevision(unsigned int revision) : revision(revision)
+  {}
+};
+
+/*!
+ * Table with memorized results of GetImplicitConversionOptions().
+ * Results are computed on first request - as implicit casts via underlying types do not appear in any register and cannot be enumerated up front.
+ *
+ * Lookups are wait-free (RCU-style, like tSnapshotList): the current revision's index is published atomically.
+ * Only adding results and replacing the index after registered operations changed are serialized with the mutex.
+ * Results of outdated revisions are therefore never looked up. Their (typically small) indices are retained for
+ * readers until shutdown - registrations, and thus revisions, are bounded.
+ */
+struct tImplicitConversionOptionsTable
+{
+  /*! Index of current revision */
+  std::atomic<tImplicitConversionOptionsRevision*> current;
+
+  /*! Indices of all revisions (last one is current; older ones are retained for readers) */
+  std::vector<std::unique_ptr<tImplicitConversionOptionsRevision>> revisions;
+
+  /*! Mutex for adding results and replacing the index */
+  rrlib::thread::tMutex mutex;
+
+  tImplicitConversionOptionsTable()
+  {
+    revisions.emplace_back(new tImplicitConversionOptionsRevision(0));
+    current.store(revisions.back().get(), std::memory_order_relaxed);
+  }
+};
+
+tImplicitConversionOptionsTable& ImplicitConversionOptionsTable()
+{
+  static tImplicitConversionOptionsTable table;
+  return table;
+}
+
+}
+
 tStaticCastOperation tStaticCastOperation::instance;
 
 const tStaticCastOperation::tStaticCast tStaticCastOperation::tInstanceNone::value = { { tConversionOption() }, false };
@@ -77,6 +131,15 @@ const tStaticCastOperation::tStaticCast tStaticCastOperation::tInstanceNone::val
 tStaticCastOperation::tStaticCastOperation() : tRegisteredConversionOperation()
 {}
 
+void tStaticCastOperation::AddStaticCast(const tStaticCast* cast)
+{
+  tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+  registered_operations.static_casts.Add(cast);
+  registered_operations.static_cast_list.Add(cast);
+  registered_operations.static_cast_index.Add(HashTypes(cast->conversion_option.source_type, cast->conversion_option.destination_type), cast);
+  registered_operations.revision++;
+}
+
 tConversionOption tStaticCastOperation::GetConversionOption(const tType& source_type, const tType& destination_type) const
 {
   if (source_type == destination_type)
@@ -89,12 +152,10 @@ tConversionOption tStaticCastOperation::GetConversionOption(const tType& source_
     return tConversionOption(source_type, destination_type, 0);
   }
   const tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
-  for (auto & option : registered_operations.static_casts)
+  auto entry = registered_operations.static_cast_index.Find(HashTypes(source_type, destination_type));
+  if (entry)
   {
-    if (source_type == option->conversion_option.source_type && destination_type == option->conversion_option.destination_type)
-    {
-      return option->conversion_option;
-    }
+    return entry->value->conversion_option;
   }
 
   return tConversionOption();
@@ -118,11 +179,11 @@ tConversionOption tStaticCastOperation::GetImplicitConversionOption(const rrlib:
   {
     return tConversionOption(source_type, destination_type, 0);
   }
-  for (auto & option : registered_operations.static_casts)
+  for (auto entry = registered_operations.static_cast_index.Find(HashTypes(source_type, destination_type)); entry; entry = entry->NextWithSameHash())
   {
-    if (option->implicit && source_type == option->conversion_option.source_type && destination_type == option->conversion_option.destination_type)
+    if (entry->value->implicit)
     {
-      return option->conversion_option;
+      return entry->value->conversion_option;
     }
   }
   return tConversionOption();
@@ -132,36 +193,71 @@ tConversionOption tStaticCastOperation::GetImplicitConversionOption(const rrlib:
 std::pair<tConversionOption, tConversionOption> tStaticCastOperation::GetImplicitConversionOptions(const rrlib::rtti::tType& source_type, const rrlib::rtti::tType& destination_type)
 {
   const tRegisteredConversionOperation::tRegisteredOperations& registered_operations = tRegisteredConversionOperation::RegisteredOperations();
+  unsigned int revision = registered_operations.revision.load();
+  size_t key = HashTypes(source_type, destination_type);
+  auto& table = ImplicitConversionOptionsTable();
+  const tImplicitConversionOptionsRevision* current = table.current.load(std::memory_order_acquire);
+  if (current->revision == revision)
+  {
+    auto entry = current->results.Find(key);
+    if (entry)
+    {
+      return entry->value;
+    }
+  }
+
+  std::pair<tConversionOption, tConversionOption> result;
   tConversionOption single_result = GetImplicitConversionOption(source_type, destination_type, registered_operations);
   if (single_result.type != tConversionOptionType::NONE)
   {
-    return std::pair<tConversionOption, tConversionOption>(single_result, tConversionOption());
+    result.first = single_result;
   }
-
-  // Try all registered operations
-  for (auto & option : registered_operations.static_casts)
+  else
   {
-    if (option->implicit)
+    // Try all registered operations (each check is a constant-time lookup)
+    for (auto option : registered_operations.static_cast_list.GetSnapshot())
     {
-      if (source_type == option->conversion_option.source_type)
+      if (option->implicit)
       {
-        tConversionOption second_option = GetImplicitConversionOption(option->conversion_option.destination_type, destination_type, registered_operations);
-        if (second_option.type != tConversionOptionType::NONE)
+        if (source_type == option->conversion_option.source_type)
         {
-          return std::pair<tConversionOption, tConversionOption>(option->conversion_option, second_option);
+          tConversionOption second_option = GetImplicitConversionOption(option->conversion_option.destination_type, destination_type, registered_operations);
+          if (second_option.type != tConversionOptionType::NONE)
+          {
+            result = std::pair<tConversionOption, tConversionOption>(option->conversion_option, second_option);
+            break;
+          }
         }
-      }
-      if (destination_type == option->conversion_option.destination_type)
-      {
-        tConversionOption first_option = GetImplicitConversionOption(source_type, option->conversion_option.source_type, registered_operations);
-        if (first_option.type != tConversionOptionType::NONE)
+        if (destination_type == option->conversion_option.destination_type)
         {
-          return std::pair<tConversionOption, tConversionOption>(first_option, option->conversion_option);
+          tConversionOption first_option = GetImplicitConversionOption(source_type, option->conversion_option.source_type, registered_operations);
+          if (first_option.type != tConversionOptionType::NONE)
+          {
+            result = std::pair<tConversionOption, tConversionOption>(first_option, option->conversion_option);
+            break;
+          }
         }
       }
     }
   }
-  return std::pair<tConversionOption, tConversionOption>(tConversionOption(), tConversionOption());
+
+  rrlib::thread::tLock lock(table.mutex);
+  if (registered_operations.revision.load() != revision)
+  {
+    return result; // registered operations changed meanwhile: do not add possibly outdated result
+  }
+  tImplicitConversionOptionsRevision* index = table.current.load(std::memory_order_relaxed);
+  if (index->revision != revision)
+  {
+    table.revisions.emplace_back(new tImplicitConversionOptionsRevision(revision));
+    index = table.revisions.back().get();
+    table.current.store(index, std::memory_order_release);
+  }
+  if (!index->results.Find(key))  // another thread may have been faster
+  {
+    index->results.Add(key, result);
+  }
+  return result;
 }
 
 //----------------------------------------------------------------------
@@ -48,6 +48,8 @@
 #include "rrlib/rtti_conversion/tRegisteredConversionOperation.h"
 #include "rrlib/rtti_conversion/type_traits.h"
 #include "rrlib/rtti_conversion/tCompiledConversionOperation.h"
+#include "rrlib/rtti_conversion/simd_casts.h"
+#include "rrlib/rtti_conversion/tScratchIntermediate.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -90,7 +92,20 @@ class tStaticCastOperation : public tRegisteredConversionOperation
       operation.Continue(tTypedConstPointer(&intermediate), destination_object);
     }
 
-    static constexpr tStaticCast value = { { tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), StaticCastReferencesSourceWithVariableOffset<TSource, TDestination>::value, &ConvertFirst, &ConvertFinal) }, IsImplicitlyConvertible<TDestination, TSource>::value };
+    static void ConvertBatch(const void* source, size_t source_stride, void* destination, size_t destination_stride, size_t count, const tCurrentConversionOperation& operation)
+    {
+      if (source_stride == sizeof(TSource) && destination_stride == sizeof(TDestination))
+      {
+        StaticCastArray(static_cast<const TSource*>(source), static_cast<TDestination*>(destination), count);
+        return;
+      }
+      for (size_t i = 0; i < count; i++)
+      {
+        *reinterpret_cast<TDestination*>(static_cast<char*>(destination) + i * destination_stride) = static_cast<TDestination>(*reinterpret_cast<const TSource*>(static_cast<const char*>(source) + i * source_stride));
+      }
+    }
+
+    static constexpr tStaticCast value = { { tConversionOption(tDataType<TSource>(), tDataType<TDestination>(), StaticCastReferencesSourceWithVariableOffset<TSource, TDestination>::value, &ConvertFirst, &ConvertFinal, &ConvertBatch) }, IsImplicitlyConvertible<TDestination, TSource>::value };
     enum { cREGISTER_OPERATION = 1 };
   };
 
@@ -164,27 +179,36 @@ class tStaticCastOperation : public tRegisteredConversionOperation
   {
     static void ConvertFinal(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
     {
-      const std::vector<TSource>& source = *source_object.Get<std::vector<TSource>>();
-      std::vector<TDestination>& destination = *destination_object.Get<std::vector<TDestination>>();
-      destination.resize(source.size());
-      auto it_dest = destination.begin();
-      for (auto it = source.begin(); it != source.end(); ++it, ++it_dest)
-      {
-        *it_dest = static_cast<TDestination>(*it);
-      }
+      CastElements(*source_object.Get<std::vector<TSource>>(), *destination_object.Get<std::vector<TDestination>>());
     }
 
     static void ConvertFirst(const tTypedConstPointer& source_object, const tTypedPointer& destination_object, const tCurrentConversionOperation& operation)
     {
-      const std::vector<TSource>& source = *source_object.Get<std::vector<TSource>>();
-      std::vector<TDestination> intermediate;
-      intermediate.resize(source.size());
-      auto it_dest = intermediate.begin();
+      tScratchIntermediate<std::vector<TDestination>> intermediate;
+      CastElements(*source_object.Get<std::vector<TSource>>(), intermediate.Get());
+      operation.Continue(tTypedConstPointer(&intermediate.Get()), destination_object);
+    }
+
+    static void CastElements(const std::vector<TSource>& source, std::vector<TDestination>& destination)
+    {
+      destination.resize(source.size());
+      CastElements(source, destination, std::integral_constant < bool, std::is_same<TSource, bool>::value || std::is_same<TDestination, bool>::value > ());
+    }
+
+    /*! Contiguous storage: array cast (vectorized for common numeric types) */
+    static void CastElements(const std::vector<TSource>& source, std::vector<TDestination>& destination, std::false_type)
+    {
+      StaticCastArray(source.data(), destination.data(), source.size());
+    }
+
+    /*! std::vector<bool> has no contiguous storage */
+    static void CastElements(const std::vector<TSource>& source, std::vector<TDestination>& destination, std::true_type)
+    {
+      auto it_dest = destination.begin();
       for (auto it = source.begin(); it != source.end(); ++it, ++it_dest)
       {
         *it_dest = static_cast<TDestination>(*it);
       }
-      operation.Continue(tTypedConstPointer(&intermediate), destination_object);
     }
 
     static constexpr tStaticCast value = { { tConversionOption(tDataType<std::vector<TSource>>(), tDataType<std::vector<TDestination>>(), StaticCastReferencesSourceWithVariableOffset<TSource, TDestination>::value, &ConvertFirst, &ConvertFinal) }, false };
@@ -272,22 +296,21 @@ public:
     typedef tInstanceVector < typename std::conditional < Tregister_dedicated_vector_cast && Tregister_reverse_operation, TDestination, void >::type,
             typename std::conditional < Tregister_dedicated_vector_cast && Tregister_reverse_operation, TSource, void >::type > tVectorOperationReverse;
 
-    tRegisteredOperations& registered_ops = tRegisteredConversionOperation::RegisteredOperations();
     if (tOperation::cREGISTER_OPERATION)
     {
-      registered_ops.static_casts.Add(&tOperation::value);
+      AddStaticCast(&tOperation::value);
     }
     if (tOperationReverse::cREGISTER_OPERATION)
     {
-      registered_ops.static_casts.Add(&tOperationReverse::value);
+      AddStaticCast(&tOperationReverse::value);
     }
     if (tVectorOperation::cREGISTER_OPERATION)
     {
-      registered_ops.static_casts.Add(&tVectorOperation::value);
+      AddStaticCast(&tVectorOperation::value);
     }
     if (tVectorOperationReverse::cREGISTER_OPERATION)
     {
-      registered_ops.static_casts.Add(&tVectorOperationReverse::value);
+      AddStaticCast(&tVectorOperationReverse::value);
     }
 
     return instance;
@@ -303,6 +326,23 @@ private:
 
   tStaticCastOperation();
 
+  /*!
+   * Adds static cast to register and index
+   *
+   * \param cast Static cast to add
+   */
+  static void AddStaticCast(const tStaticCast* cast);
+
+  /*!
+   * \param source_type Source type
+   * \param destination_type Destination type
+   * \return Hash value for type pair as used in static cast index (unique for every type pair)
+   */
+  static size_t HashTypes(const rrlib::rtti::tType& source_type, const rrlib::rtti::tType& destination_type)
+  {
+    return (static_cast<size_t>(source_type.GetHandle()) << 16) | destination_type.GetHandle();
+  }
+
   /*!
    * Internal version of GetImplicitConversionOption (must only be called with lock in registered_operations)
    */
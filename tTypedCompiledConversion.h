@@ -0,0 +1,346 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tTypedCompiledConversion.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tTypedCompiledConversion
+ *
+ * \b tTypedCompiledConversion
+ *
+ * Conversion for source and destination types known at compile time.
+ * Static casts, const offsets, and function-based operations are resolved at compile time
+ * and can be inlined down to a direct call, assignment or memcpy.
+ *
+ * Typed conversions are created with MakeTypedCompiledConversion(), e.g.
+ *
+ * auto conversion = MakeTypedCompiledConversion<int, double>(tStaticCastOperation::GetInstance());
+ * double d = conversion.Convert(42);
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tTypedCompiledConversion_h__
+#define __rrlib__rtti_conversion__tTypedCompiledConversion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <limits>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+#include "rrlib/rtti_conversion/definition/tConstOffsetConversionOperation.h"
+#include "rrlib/rtti_conversion/definition/tMemberFunctionConversionOperation.h"
+#include "rrlib/rtti_conversion/definition/tReturnFunctionConversionOperation.h"
+#include "rrlib/rtti_conversion/definition/tVoidFunctionConversionOperation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Static cast (also deep copy if types are equal) */
+template <typename TSource, typename TDestination>
+struct tTypedStaticCast
+{
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    destination = static_cast<TDestination>(source);
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    StaticCastArray(source, destination, count);
+  }
+};
+
+/*! Const offset */
+template <typename TSource, typename TDestination, size_t Toffset>
+struct tTypedConstOffset
+{
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    destination = *reinterpret_cast<const TDestination*>(reinterpret_cast<const char*>(&source) + Toffset);
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      Convert(source[i], destination[i]);
+    }
+  }
+};
+
+/*! Function returning destination */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function>
+struct tTypedReturnFunction
+{
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    destination = (*Tconversion_function)(source);
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      Convert(source[i], destination[i]);
+    }
+  }
+};
+
+/*! Member function of source returning destination */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function>
+struct tTypedMemberFunction
+{
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    destination = (source.*Tconversion_function)();
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      Convert(source[i], destination[i]);
+    }
+  }
+};
+
+/*! Function writing to destination */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function>
+struct tTypedVoidFunction
+{
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    (*Tconversion_function)(source, destination);
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      Convert(source[i], destination[i]);
+    }
+  }
+};
+
+/*! Any other conversion operation sequence (compiled at runtime - deep copies are still done without dispatching) */
+template <typename TSource, typename TDestination>
+struct tTypedCompiledOperation
+{
+  explicit tTypedCompiledOperation(const tConversionOperationSequence& sequence) :
+    compiled_operation(sequence.Compile(false, tDataType<TSource>(), tDataType<TDestination>())),
+    deep_copy_offset((compiled_operation.Flags() & tCompiledConversionOperation::tFlag::cDEEPCOPY_ONLY) ? compiled_operation.DeepCopyOffset() : cNO_DEEP_COPY)
+  {}
+
+  void Convert(const TSource& source, TDestination& destination) const
+  {
+    if (deep_copy_offset != cNO_DEEP_COPY)
+    {
+      destination = *reinterpret_cast<const TDestination*>(reinterpret_cast<const char*>(&source) + deep_copy_offset);
+    }
+    else
+    {
+      compiled_operation.Convert(tTypedConstPointer(&source), tTypedPointer(&destination));
+    }
+  }
+
+  void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    compiled_operation.ConvertBatch(source, sizeof(TSource), destination, sizeof(TDestination), count);
+  }
+
+private:
+
+  enum : size_t { cNO_DEEP_COPY = std::numeric_limits<size_t>::max() };
+
+  tCompiledConversionOperation compiled_operation;
+
+  /*! If conversion is a deep copy: offset of destination in source (cNO_DEEP_COPY otherwise) */
+  size_t deep_copy_offset;
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Typed compiled conversion
+/*!
+ * Conversion for source and destination types known at compile time.
+ * Unlike tCompiledConversionOperation, no typed pointers and tCurrentConversionOperation objects are created.
+ * If the conversion operation is known at compile time (see MakeTypedCompiledConversion() overloads), Convert() calls are
+ * resolved at compile time and can be inlined.
+ *
+ * \tparam TSource Source type
+ * \tparam TDestination Destination type
+ * \tparam TImplementation Implementation of conversion (one of the types in namespace internal)
+ */
+template <typename TSource, typename TDestination, typename TImplementation = internal::tTypedCompiledOperation<TSource, TDestination>>
+class tTypedCompiledConversion
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  explicit tTypedCompiledConversion(const TImplementation& implementation = TImplementation()) :
+    implementation(implementation)
+  {}
+
+  /*!
+   * Converts source to destination object
+   *
+   * \param source Source object
+   * \param destination Destination object
+   */
+  inline void Convert(const TSource& source, TDestination& destination) const
+  {
+    implementation.Convert(source, destination);
+  }
+
+  /*!
+   * \param source Source object
+   * \return Converted object
+   */
+  inline TDestination Convert(const TSource& source) const
+  {
+    TDestination destination = TDestination();
+    implementation.Convert(source, destination);
+    return destination;
+  }
+
+  /*!
+   * Converts array of objects
+   *
+   * \param source Source array
+   * \param destination Destination array (must not overlap with source array)
+   * \param count Number of objects to convert
+   */
+  inline void ConvertBatch(const TSource* source, TDestination* destination, size_t count) const
+  {
+    implementation.ConvertBatch(source, destination, count);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Implementation of conversion */
+  TImplementation implementation;
+};
+
+/*!
+ * Creates typed conversion from static cast (or deep copy if TSource and TDestination are equal)
+ */
+template <typename TSource, typename TDestination>
+inline tTypedCompiledConversion<TSource, TDestination, internal::tTypedStaticCast<TSource, TDestination>> MakeTypedCompiledConversion(const tStaticCastOperation&)
+{
+  return tTypedCompiledConversion<TSource, TDestination, internal::tTypedStaticCast<TSource, TDestination>>();
+}
+
+/*!
+ * Creates typed deep copy
+ */
+template <typename T>
+inline tTypedCompiledConversion<T, T, internal::tTypedStaticCast<T, T>> MakeTypedCompiledConversion()
+{
+  return tTypedCompiledConversion<T, T, internal::tTypedStaticCast<T, T>>();
+}
+
+/*!
+ * Creates typed conversion from const offset operation
+ */
+template <typename TSource, typename TDestination, size_t Toffset>
+inline tTypedCompiledConversion<TSource, TDestination, internal::tTypedConstOffset<TSource, TDestination, Toffset>> MakeTypedCompiledConversion(const tConstOffsetConversionOperation<TSource, TDestination, Toffset>&)
+{
+  return tTypedCompiledConversion<TSource, TDestination, internal::tTypedConstOffset<TSource, TDestination, Toffset>>();
+}
+
+/*!
+ * Creates typed conversion from operation with function returning the destination
+ */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function, bool Tvariable_offset>
+inline tTypedCompiledConversion<TSource, typename std::decay<TDestination>::type, internal::tTypedReturnFunction<TSource, typename std::decay<TDestination>::type, TFunction, Tconversion_function>> MakeTypedCompiledConversion(const tReturnFunctionConversionOperation<TSource, TDestination, TFunction, Tconversion_function, Tvariable_offset>&)
+{
+  return tTypedCompiledConversion<TSource, typename std::decay<TDestination>::type, internal::tTypedReturnFunction<TSource, typename std::decay<TDestination>::type, TFunction, Tconversion_function>>();
+}
+
+/*!
+ * Creates typed conversion from operation with member function of source returning the destination
+ */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function, bool Tvariable_offset>
+inline tTypedCompiledConversion<TSource, typename std::decay<TDestination>::type, internal::tTypedMemberFunction<TSource, typename std::decay<TDestination>::type, TFunction, Tconversion_function>> MakeTypedCompiledConversion(const tMemberFunctionConversionOperation<TSource, TDestination, TFunction, Tconversion_function, Tvariable_offset>&)
+{
+  return tTypedCompiledConversion<TSource, typename std::decay<TDestination>::type, internal::tTypedMemberFunction<TSource, typename std::decay<TDestination>::type, TFunction, Tconversion_function>>();
+}
+
+/*!
+ * Creates typed conversion from operation with function writing to destination
+ */
+template <typename TSource, typename TDestination, typename TFunction, TFunction Tconversion_function>
+inline tTypedCompiledConversion<TSource, TDestination, internal::tTypedVoidFunction<TSource, TDestination, TFunction, Tconversion_function>> MakeTypedCompiledConversion(const tVoidFunctionConversionOperation<TSource, TDestination, TFunction, Tconversion_function>&)
+{
+  return tTypedCompiledConversion<TSource, TDestination, internal::tTypedVoidFunction<TSource, TDestination, TFunction, Tconversion_function>>();
+}
+
+/*!
+ * Creates typed conversion from any other conversion operation sequence (compiled at runtime)
+ *
+ * \throw Throws exception if sequence cannot be compiled for TSource and TDestination (see tConversionOperationSequence::Compile())
+ */
+template <typename TSource, typename TDestination>
+inline tTypedCompiledConversion<TSource, TDestination> MakeTypedCompiledConversion(const tConversionOperationSequence& sequence)
+{
+  return tTypedCompiledConversion<TSource, TDestination>(internal::tTypedCompiledOperation<TSource, TDestination>(sequence));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,226 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tWorkerPool.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/tWorkerPool.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! True in worker threads of pool */
+thread_local bool this_thread_is_worker = false;
+
+}
+
+tWorkerPool::tWorkerPool() :
+  mutex(),
+  job_available(mutex),
+  shutdown(false)
+{
+  unsigned int hardware_threads = std::thread::hardware_concurrency();
+  size_t worker_count = hardware_threads > 1 ? hardware_threads - 1 : 0;
+  for (size_t i = 0; i < worker_count; i++)
+  {
+    workers.emplace_back(&tWorkerPool::WorkerMain, this);
+  }
+}
+
+tWorkerPool::~tWorkerPool()
+{
+  {
+    rrlib::thread::tLock lock(mutex);
+    shutdown = true;
+    job_available.NotifyAll(lock);
+  }
+  for (auto & worker : workers)
+  {
+    worker.join();
+  }
+}
+
+tWorkerPool& tWorkerPool::Instance()
+{
+  static tWorkerPool instance;
+  return instance;
+}
+
+void tWorkerPool::ParallelFor(size_t count, size_t chunk_size, const tRangeFunction& function)
+{
+  chunk_size = std::max<size_t>(chunk_size, 1);
+  if (count <= chunk_size || workers.empty() || this_thread_is_worker)
+  {
+    if (count)
+    {
+      function(0, count);
+    }
+    return;
+  }
+
+  std::shared_ptr<tJob> job(new tJob(function, count, chunk_size));
+  {
+    rrlib::thread::tLock lock(mutex);
+    jobs.push_back(job);
+    job_available.NotifyAll(lock);
+  }
+
+  ProcessChunks(*job);
+  {
+    rrlib::thread::tLock lock(mutex);
+    auto it = std::find(jobs.begin(), jobs.end(), job);
+    if (it != jobs.end())
+    {
+      jobs.erase(it);
+    }
+  }
+  {
+    rrlib::thread::tLock lock(job->mutex);
+    while (job->completed_chunks.load() != job->chunk_count)
+    {
+      job->completed.Wait(lock);
+    }
+  }
+
+  if (job->exception)
+  {
+    std::rethrow_exception(job->exception);
+  }
+}
+
+void tWorkerPool::ProcessChunks(tJob& job)
+{
+  while (true)
+  {
+    size_t chunk = job.next_chunk.fetch_add(1);
+    if (chunk >= job.chunk_count)
+    {
+      return;
+    }
+
+    // Chunks after a failed chunk are skipped - chunks before are processed so that the reported exception does not depend on scheduling
+    if (chunk < job.failed_chunk.load(std::memory_order_relaxed))
+    {
+      size_t begin = chunk * job.chunk_size;
+      try
+      {
+        job.function(begin, std::min(begin + job.chunk_size, job.count));
+      }
+      catch (...)
+      {
+        rrlib::thread::tLock lock(job.mutex);
+        if (chunk < job.failed_chunk.load())
+        {
+          job.failed_chunk = chunk;
+          job.exception = std::current_exception();
+        }
+      }
+    }
+
+    if (job.completed_chunks.fetch_add(1) + 1 == job.chunk_count)
+    {
+      rrlib::thread::tLock lock(job.mutex);
+      job.completed.NotifyAll(lock);
+    }
+  }
+}
+
+void tWorkerPool::WorkerMain()
+{
+  this_thread_is_worker = true;
+  while (true)
+  {
+    std::shared_ptr<tJob> job;
+    {
+      rrlib::thread::tLock lock(mutex);
+      while ((!shutdown) && jobs.empty())
+      {
+        job_available.Wait(lock);
+      }
+      if (shutdown)
+      {
+        return;
+      }
+      job = jobs.front();
+    }
+
+    ProcessChunks(*job);
+
+    // No chunks left to claim: remove job from queue (if calling thread has not done so already)
+    rrlib::thread::tLock lock(mutex);
+    if ((!jobs.empty()) && jobs.front() == job)
+    {
+      jobs.pop_front();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
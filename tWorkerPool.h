@@ -0,0 +1,191 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tWorkerPool.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tWorkerPool
+ *
+ * \b tWorkerPool
+ *
+ * Process-wide pool of worker threads for converting large amounts of data in parallel
+ * (used by the For Each operation).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti_conversion__tWorkerPool_h__
+#define __rrlib__rtti_conversion__tWorkerPool_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/thread/tConditionVariable.h"
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Pool of worker threads
+/*!
+ * Process-wide pool of worker threads (one less than the number of hardware threads - as the calling thread participates).
+ * Workers are started when the pool is used for the first time.
+ *
+ * Ranges are split into chunks that idle workers (and the calling thread) claim one after another,
+ * so that threads finishing early take over the remaining work.
+ */
+class tWorkerPool : public rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Function that processes elements [begin, end) of a range */
+  typedef std::function<void (size_t begin, size_t end)> tRangeFunction;
+
+  ~tWorkerPool();
+
+  /*!
+   * \return Single instance of worker pool
+   */
+  static tWorkerPool& Instance();
+
+  /*!
+   * Processes range of elements in parallel.
+   * Returns when all elements have been processed.
+   * If called from a worker thread (nested parallel operations), the range is processed by the calling thread only.
+   *
+   * \param count Number of elements in range
+   * \param chunk_size Number of elements that are processed by a thread at once
+   * \param function Function that processes chunks. Is called concurrently from different threads.
+   * \throw If function throws, the exception is rethrown. If multiple chunks throw, the exception of the chunk with the lowest index is rethrown
+   *        (chunks before are processed completely - so the result is the same as with processing the range sequentially).
+   */
+  void ParallelFor(size_t count, size_t chunk_size, const tRangeFunction& function);
+
+  /*!
+   * \return Number of worker threads (excluding calling thread)
+   */
+  size_t WorkerCount() const
+  {
+    return workers.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Range to be processed by ParallelFor() */
+  struct tJob
+  {
+    const tRangeFunction& function;
+    const size_t count, chunk_size, chunk_count;
+
+    /*! Index of next chunk to process */
+    std::atomic<size_t> next_chunk;
+
+    /*! Number of chunks that have been processed */
+    std::atomic<size_t> completed_chunks;
+
+    /*! Index of first chunk that threw an exception (chunk_count if there is no such chunk) */
+    std::atomic<size_t> failed_chunk;
+
+    /*! Exception of failed_chunk */
+    std::exception_ptr exception;
+
+    /*! Mutex and condition variable to signal completion (mutex also protects exception) */
+    rrlib::thread::tMutex mutex;
+    rrlib::thread::tConditionVariable completed;
+
+    tJob(const tRangeFunction& function, size_t count, size_t chunk_size) :
+      function(function), count(count), chunk_size(chunk_size), chunk_count((count + chunk_size - 1) / chunk_size),
+      next_chunk(0), completed_chunks(0), failed_chunk(chunk_count), mutex(), completed(mutex)
+    {}
+  };
+
+  /*! Worker threads */
+  std::vector<std::thread> workers;
+
+  /*! Jobs that have chunks left to claim */
+  std::deque<std::shared_ptr<tJob>> jobs;
+
+  /*! Mutex for jobs and shutdown */
+  rrlib::thread::tMutex mutex;
+
+  /*! Notifies workers about new jobs */
+  rrlib::thread::tConditionVariable job_available;
+
+  /*! Set to true when pool is destructed */
+  bool shutdown;
+
+
+  tWorkerPool();
+
+  /*!
+   * Processes chunks of job until no chunks are left to claim
+   */
+  static void ProcessChunks(tJob& job);
+
+  /*!
+   * Main loop of worker threads
+   */
+  void WorkerMain();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,361 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tests/conversion_benchmark.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * Measures costs of conversion operations: each tConversionOptionType, two-step sequences,
+ * For Each with different vector sizes, (de)serialization operations, as well as latency of
+ * compiling sequences and looking up operations by name.
+ *
+ * Output is CSV: benchmark,ns_per_op,allocations_per_op,bytes_allocated_per_op
+ * (optionally, a substring can be passed as argument to run only benchmarks whose names contain it)
+ *
+ * With arguments '--calibrate <file>', conversion costs are measured on sample data of common types
+ * and saved as conversion cost profile (see tConversionCostProfile) instead.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/defined_conversions.h"
+#include "rrlib/rtti_conversion/tConversionCostProfile.h"
+#include "rrlib/rtti_conversion/tConversionPathPlanner.h"
+#include "rrlib/rtti_conversion/tStaticCastOperation.h"
+#include "rrlib/rtti_conversion/tTypedCompiledConversion.h"
+#include "rrlib/rtti_conversion/definition/tConstOffsetConversionOperation.h"
+#include "rrlib/rtti_conversion/definition/tReturnFunctionConversionOperation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::rtti;
+using namespace rrlib::rtti::conversion;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Source type for const offset and result-references-source conversions */
+struct tBenchmarkPoint
+{
+  double x, y;
+};
+
+/*! Wrapper type referencing tBenchmarkPoint */
+struct tBenchmarkPointView
+{
+  const tBenchmarkPoint* point;
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Minimum duration of each measurement */
+const std::chrono::milliseconds cMIN_DURATION(200);
+
+/*! Vector sizes for For Each benchmarks */
+const size_t cFOR_EACH_SIZES[] = { 16, 1024, 65536 };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Allocation counters (incremented by global operator new) */
+std::atomic<size_t> allocation_count(0), allocated_bytes(0);
+
+/*! Only benchmarks whose names contain this string are run */
+const char* benchmark_filter = "";
+
+tBenchmarkPointView GetView(const tBenchmarkPoint& point)
+{
+  return tBenchmarkPointView { &point };
+}
+
+const tConstOffsetConversionOperation<tBenchmarkPoint, double, offsetof(tBenchmarkPoint, y)> cGET_Y("Benchmark Get Y");
+const tReturnFunctionConversionOperation<tBenchmarkPoint, tBenchmarkPointView, decltype(&GetView), &GetView, true> cGET_VIEW("Benchmark Get View");
+
+}
+
+void* operator new(size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  void* result = malloc(size ? size : 1);
+  if (!result)
+  {
+    throw std::bad_alloc();
+  }
+  return result;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  free(pointer);
+}
+
+/*!
+ * Prevents compiler from optimizing away computation of value (e.g. in inlined typed conversions)
+ */
+template <typename T>
+inline void KeepResult(const T& value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+/*!
+ * Runs function repeatedly for at least cMIN_DURATION and prints one line of CSV output
+ *
+ * \param name Name of benchmark
+ * \param function Function to benchmark (one operation)
+ */
+template <typename TFunction>
+void Benchmark(const std::string& name, TFunction function)
+{
+  if (!strstr(name.c_str(), benchmark_filter))
+  {
+    return;
+  }
+
+  function();  // warm up (e.g. lazily initialized data)
+  size_t iterations = 0;
+  size_t allocations_before = allocation_count.load();
+  size_t bytes_before = allocated_bytes.load();
+  auto start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration elapsed;
+  do
+  {
+    for (size_t i = 0; i < 16; i++)
+    {
+      function();
+    }
+    iterations += 16;
+    elapsed = std::chrono::steady_clock::now() - start;
+  }
+  while (elapsed < cMIN_DURATION);
+  double allocations = static_cast<double>(allocation_count.load() - allocations_before) / iterations;
+  double bytes = static_cast<double>(allocated_bytes.load() - bytes_before) / iterations;
+  printf("%s,%.2f,%.2f,%.1f\n", name.c_str(), std::chrono::duration<double, std::nano>(elapsed).count() / iterations, allocations, bytes);
+  fflush(stdout);
+}
+
+/*!
+ * Benchmarks converting source to destination with compiled sequence
+ */
+template <typename TSource, typename TDestination>
+void BenchmarkConversion(const std::string& name, const tConversionOperationSequence& sequence, const TSource& source)
+{
+  tCompiledConversionOperation operation = sequence.Compile(false, tDataType<TSource>(), tDataType<TDestination>());
+  TDestination destination = TDestination();
+  Benchmark(name, [&]()
+  {
+    operation.Convert(tTypedConstPointer(&source), tTypedPointer(&destination));
+  });
+}
+
+/*!
+ * Measures conversion costs on sample data and saves them to profile file
+ */
+int Calibrate(const std::string& file_name)
+{
+  int32_t int_sample = 123456;
+  double double_sample = 3.14159;
+  float float_sample = 2.5f;
+  std::string string_sample = "123";
+  tBenchmarkPoint point_sample = { 1.0, 2.0 };
+  std::vector<double> list_sample(16, 3.0);
+  std::vector<tTypedConstPointer> samples = { tTypedConstPointer(&int_sample), tTypedConstPointer(&double_sample), tTypedConstPointer(&float_sample), tTypedConstPointer(&string_sample), tTypedConstPointer(&point_sample), tTypedConstPointer(&list_sample) };
+  size_t measured = tConversionCostProfile::Calibrate(samples);
+  tConversionCostProfile::Save(file_name);
+  printf("Measured %zu conversions. Profile saved to %s\n", measured, file_name.c_str());
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 2 && std::string(argv[1]) == "--calibrate")
+  {
+    return Calibrate(argv[2]);
+  }
+  if (argc > 1)
+  {
+    benchmark_filter = argv[1];
+  }
+  printf("benchmark,ns_per_op,allocations_per_op,bytes_allocated_per_op\n");
+
+  // Conversion option types
+  const tRegisteredConversionOperation& static_cast_operation = tStaticCastOperation::GetInstance();
+  tBenchmarkPoint point = { 1.0, 2.0 };
+  std::vector<double> list(16, 3.0);
+  BenchmarkConversion<int32_t, double>("option/standard(static_cast int32_t->double)", tConversionOperationSequence(static_cast_operation), 42);
+  BenchmarkConversion<tBenchmarkPoint, double>("option/const_offset(Get Y)", tConversionOperationSequence(cGET_Y), point);
+  {
+    tConversionOperationSequence sequence(cGET_LIST_ELEMENT_OPERATION);
+    sequence.SetParameterValue(0, std::string("5"));
+    BenchmarkConversion<std::vector<double>, double>("option/variable_offset([] std::vector<double>)", sequence, list);
+  }
+  BenchmarkConversion<tBenchmarkPoint, tBenchmarkPointView>("option/result_references_source(Get View)", tConversionOperationSequence(cGET_VIEW), point);
+
+  // Two-step sequences
+  BenchmarkConversion<tBenchmarkPoint, float>("sequence/const_offset+standard(Get Y, static_cast)", tConversionOperationSequence(cGET_Y, static_cast_operation), point);
+  BenchmarkConversion<int32_t, std::string>("sequence/standard+standard(static_cast, ToString)", tConversionOperationSequence(static_cast_operation, cTO_STRING_OPERATION, tDataType<double>()), 42);
+  BenchmarkConversion<tBenchmarkPoint, std::string>("sequence/const_offset+standard+standard(Get Y, static_cast, ToString)", tConversionOperationSequence({ &cGET_Y, &static_cast_operation, &cTO_STRING_OPERATION }, { tType(), tDataType<float>() }), point);
+
+  // Typed compiled conversions
+  {
+    auto typed_static_cast = MakeTypedCompiledConversion<int32_t, double>(tStaticCastOperation::GetInstance());
+    auto typed_get_y = MakeTypedCompiledConversion(cGET_Y);
+    auto typed_get_view = MakeTypedCompiledConversion(cGET_VIEW);
+    auto typed_sequence = MakeTypedCompiledConversion<int32_t, std::string>(tConversionOperationSequence(static_cast_operation, cTO_STRING_OPERATION, tDataType<double>()));
+    int32_t int_value = 42;
+    double double_value = 0;
+    tBenchmarkPointView view = { nullptr };
+    std::string string_value;
+    Benchmark("typed/static_cast int32_t->double", [&]()
+    {
+      typed_static_cast.Convert(int_value, double_value);
+      KeepResult(double_value);
+    });
+    Benchmark("typed/const_offset(Get Y)", [&]()
+    {
+      typed_get_y.Convert(point, double_value);
+      KeepResult(double_value);
+    });
+    Benchmark("typed/function(Get View)", [&]()
+    {
+      typed_get_view.Convert(point, view);
+      KeepResult(view);
+    });
+    Benchmark("typed/sequence(static_cast, ToString)", [&]()
+    {
+      typed_sequence.Convert(int_value, string_value);
+      KeepResult(string_value);
+    });
+  }
+
+  // For Each
+  for (size_t size : cFOR_EACH_SIZES)
+  {
+    std::vector<int32_t> int_list(size, 7);
+    std::vector<double> double_list(size, 7.0);
+    BenchmarkConversion<std::vector<int32_t>, std::vector<double>>("for_each/static_cast int32_t->double/" + std::to_string(size), tConversionOperationSequence(cFOR_EACH_OPERATION, static_cast_operation), int_list);
+    BenchmarkConversion<std::vector<double>, std::vector<double>>("for_each/copy double/" + std::to_string(size), tConversionOperationSequence(cFOR_EACH_OPERATION), double_list);
+    BenchmarkConversion<std::vector<int32_t>, std::vector<std::string>>("for_each/ToString int32_t/" + std::to_string(size), tConversionOperationSequence(cFOR_EACH_OPERATION, cTO_STRING_OPERATION), int_list);
+  }
+
+  // String and binary (de)serialization
+  BenchmarkConversion<int32_t, std::string>("string/ToString int32_t", tConversionOperationSequence(cTO_STRING_OPERATION), 123456);
+  BenchmarkConversion<double, std::string>("string/ToString double", tConversionOperationSequence(cTO_STRING_OPERATION), 3.14159);
+  BenchmarkConversion<std::string, int32_t>("string/String Deserialization int32_t", tConversionOperationSequence(cSTRING_DESERIALIZATION_OPERATION), std::string("123456"));
+  BenchmarkConversion<std::string, double>("string/String Deserialization double", tConversionOperationSequence(cSTRING_DESERIALIZATION_OPERATION), std::string("3.14159"));
+  BenchmarkConversion<double, rrlib::serialization::tMemoryBuffer>("binary/Binary Serialization double", tConversionOperationSequence(cBINARY_SERIALIZATION_OPERATION), 3.14159);
+  BenchmarkConversion<std::vector<double>, rrlib::serialization::tMemoryBuffer>("binary/Binary Serialization std::vector<double>", tConversionOperationSequence(cBINARY_SERIALIZATION_OPERATION), list);
+  {
+    rrlib::serialization::tMemoryBuffer buffer;
+    {
+      rrlib::serialization::tOutputStream stream(buffer);
+      stream << 3.14159;
+    }
+    BenchmarkConversion<rrlib::serialization::tMemoryBuffer, double>("binary/Binary Deserialization double", tConversionOperationSequence(cBINARY_DESERIALIZATION_OPERATION), buffer);
+  }
+  {
+    rrlib::serialization::tMemoryBuffer buffer;
+    {
+      rrlib::serialization::tOutputStream stream(buffer);
+      stream << list;
+    }
+    BenchmarkConversion<rrlib::serialization::tMemoryBuffer, std::vector<double>>("binary/Binary Deserialization std::vector<double>", tConversionOperationSequence(cBINARY_DESERIALIZATION_OPERATION), buffer);
+  }
+
+  // Compile() latency
+  {
+    tConversionOperationSequence single(static_cast_operation);
+    tConversionOperationSequence two_step(cGET_Y, static_cast_operation);
+    tConversionOperationSequence for_each(cFOR_EACH_OPERATION, static_cast_operation);
+    Benchmark("compile/static_cast int32_t->double", [&]()
+    {
+      single.Compile(false, tDataType<int32_t>(), tDataType<double>());
+    });
+    Benchmark("compile/Get Y, static_cast", [&]()
+    {
+      two_step.Compile(false, tDataType<tBenchmarkPoint>(), tDataType<float>());
+    });
+    Benchmark("compile/For Each, static_cast", [&]()
+    {
+      for_each.Compile(false, tDataType<std::vector<int32_t>>(), tDataType<std::vector<double>>());
+    });
+    Benchmark("compile/implicit cast lookup int16_t->double", [&]()
+    {
+      tStaticCastOperation::GetImplicitConversionOption(tDataType<int16_t>(), tDataType<double>());
+    });
+  }
+
+  // Find() latency
+  Benchmark("find/ToString", []()
+  {
+    tRegisteredConversionOperation::Find("ToString");
+  });
+  Benchmark("find/Benchmark Get View", []()
+  {
+    tRegisteredConversionOperation::Find("Benchmark Get View");
+  });
+  Benchmark("find/ToString int32_t->std::string", []()
+  {
+    tRegisteredConversionOperation::Find("ToString", tDataType<int32_t>(), tDataType<std::string>());
+  });
+  Benchmark("find/cheapest path tBenchmarkPoint->std::string (cached)", []()
+  {
+    tConversionPathPlanner::FindCheapestSequence(tDataType<tBenchmarkPoint>(), tDataType<std::string>());
+  });
+
+  return 0;
+}
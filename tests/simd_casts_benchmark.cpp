@@ -0,0 +1,121 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tests/simd_casts_benchmark.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * Measures throughput of numeric array casts (elements per second) -
+ * for the scalar implementation and the kernel selected for this CPU.
+ * Output is CSV: pair,implementation,elements,elements_per_second
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/simd_casts.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::rtti::conversion;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of elements in benchmarked arrays */
+const size_t cELEMENTS = 100000;
+
+/*! Minimum duration of each measurement */
+const std::chrono::milliseconds cMIN_DURATION(200);
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+template <typename TSource, typename TDestination, typename TFunction>
+double MeasureElementsPerSecond(TFunction function)
+{
+  std::vector<TSource> source(cELEMENTS);
+  std::vector<TDestination> destination(cELEMENTS);
+  for (size_t i = 0; i < cELEMENTS; i++)
+  {
+    source[i] = static_cast<TSource>(i % 100);
+  }
+
+  size_t iterations = 0;
+  auto start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration elapsed;
+  do
+  {
+    function(source.data(), destination.data(), cELEMENTS);
+    iterations++;
+    elapsed = std::chrono::steady_clock::now() - start;
+  }
+  while (elapsed < cMIN_DURATION);
+  return static_cast<double>(iterations * cELEMENTS) / std::chrono::duration<double>(elapsed).count();
+}
+
+template <typename TSource, typename TDestination>
+void Benchmark(const char* pair_name)
+{
+  const char* implementation_names[] = { "scalar", "sse2", "avx2" };
+  double scalar = MeasureElementsPerSecond<TSource, TDestination>(&StaticCastArrayScalar<TSource, TDestination>);
+  double selected = MeasureElementsPerSecond<TSource, TDestination>(&StaticCastArray<TSource, TDestination>);
+  printf("%s,scalar,%zu,%.0f\n", pair_name, cELEMENTS, scalar);
+  printf("%s,%s,%zu,%.0f\n", pair_name, implementation_names[static_cast<int>(GetSimdInstructionSet())], cELEMENTS, selected);
+}
+
+int main(int argc, char **argv)
+{
+  printf("pair,implementation,elements,elements_per_second\n");
+  Benchmark<float, double>("float->double");
+  Benchmark<double, float>("double->float");
+  Benchmark<int32_t, float>("int32_t->float");
+  Benchmark<float, int32_t>("float->int32_t");
+  Benchmark<int32_t, double>("int32_t->double");
+  Benchmark<double, int32_t>("double->int32_t");
+  Benchmark<int16_t, float>("int16_t->float");
+  Benchmark<uint16_t, float>("uint16_t->float");
+  Benchmark<uint8_t, float>("uint8_t->float");
+  Benchmark<int16_t, int32_t>("int16_t->int32_t");
+  return 0;
+}
@@ -0,0 +1,168 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti_conversion/tests/simd_casts_test.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-16
+ *
+ * Checks that the kernel selected for this CPU produces bit-exactly the same results
+ * as the scalar implementation - for all specialized pairs of types, all array lengths
+ * from 0 to 1001 (covering all tail lengths), unaligned arrays and special values
+ * (out-of-range values, infinities, NaN, denormals and values halfway between integers).
+ * Returns non-zero and prints the first mismatch of each pair if results differ.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti_conversion/simd_casts.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::rtti::conversion;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Maximum array length that is checked */
+const size_t cMAX_LENGTH = 1001;
+
+/*! Maximum offset of arrays from their (aligned) buffer start */
+const size_t cMAX_OFFSET = 3;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! Simple deterministic pseudo random number generator (64 bit LCG) */
+uint64_t NextRandom(uint64_t& state)
+{
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state >> 11;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type RandomValue(uint64_t& state, size_t)
+{
+  uint64_t bits = NextRandom(state);
+  T value;
+  memcpy(&value, &bits, sizeof(T));  // covers full range of type
+  return value;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type RandomValue(uint64_t& state, size_t index)
+{
+  const T special_values[] =
+  {
+    T(0), -T(0), T(0.5), T(-0.5), T(1.5), T(2.5), T(-2.5), T(2147483647.0), T(2147483648.0), T(-2147483648.0), T(-2147483904.0),
+    T(3e9), T(-3e9), T(1e30), T(-1e30), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), std::numeric_limits<T>::denorm_min(),
+    std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()
+  };
+  const size_t special_value_count = sizeof(special_values) / sizeof(T);
+  uint64_t random = NextRandom(state);
+  if (index % 4 == 0)
+  {
+    return special_values[random % special_value_count];
+  }
+  T magnitude = static_cast<T>(uint64_t(1) << (random % 40));
+  return (static_cast<T>(random % 2000001) / T(1000000) - T(1)) * magnitude;  // values in [-2^39, 2^39] - including fractions
+}
+
+template <typename TSource, typename TDestination>
+bool Check(const char* pair_name)
+{
+  uint64_t random_state = 42;
+  std::vector<TSource> source(cMAX_LENGTH + cMAX_OFFSET);
+  for (size_t i = 0; i < source.size(); i++)
+  {
+    source[i] = RandomValue<TSource>(random_state, i);
+  }
+  std::vector<TDestination> expected(cMAX_LENGTH + cMAX_OFFSET), result(cMAX_LENGTH + cMAX_OFFSET);
+
+  for (size_t offset = 0; offset <= cMAX_OFFSET; offset++)
+  {
+    for (size_t length = 0; length <= cMAX_LENGTH; length++)
+    {
+      const TSource* source_start = source.data() + offset;
+      memset(expected.data(), 0xAB, expected.size() * sizeof(TDestination));
+      memset(result.data(), 0xAB, result.size() * sizeof(TDestination));
+      StaticCastArrayScalar<TSource, TDestination>(source_start, expected.data() + offset, length);
+      StaticCastArray<TSource, TDestination>(source_start, result.data() + offset, length);
+      if (memcmp(expected.data(), result.data(), expected.size() * sizeof(TDestination)) != 0)  // also detects writes beyond array
+      {
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+          if (memcmp(&expected[i], &result[i], sizeof(TDestination)) != 0)
+          {
+            printf("%s: mismatch at index %zu (offset %zu, length %zu): expected %.17g, got %.17g\n", pair_name, i, offset, length,
+                   static_cast<double>(expected[i]), static_cast<double>(result[i]));
+            break;
+          }
+        }
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  const char* implementation_names[] = { "scalar", "sse2", "avx2" };
+  printf("Checking %s kernels against scalar implementation\n", implementation_names[static_cast<int>(GetSimdInstructionSet())]);
+  bool ok = true;
+  ok &= Check<float, double>("float->double");
+  ok &= Check<double, float>("double->float");
+  ok &= Check<int32_t, float>("int32_t->float");
+  ok &= Check<float, int32_t>("float->int32_t");
+  ok &= Check<int32_t, double>("int32_t->double");
+  ok &= Check<double, int32_t>("double->int32_t");
+  ok &= Check<int16_t, float>("int16_t->float");
+  ok &= Check<uint16_t, float>("uint16_t->float");
+  ok &= Check<uint8_t, float>("uint8_t->float");
+  ok &= Check<int16_t, int32_t>("int16_t->int32_t");
+  printf(ok ? "All results are bit-exact\n" : "Results differ\n");
+  return ok ? 0 : 1;
+}